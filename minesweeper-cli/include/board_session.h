@@ -0,0 +1,81 @@
+#pragma once
+
+#include "board.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+// Plays a board from commands instead of the mouse, with no window. Every command gets exactly one answer, in the
+// order the commands came in. The commands come in as text lines or as binary frames:
+//
+//	Text                          Binary frame (integers in the machine's byte order)
+//	new <seed> <w> <h> <mines>    'n', uint32 seed, uint64 width, uint64 height, uint64 mines
+//	open <x> <y>                  'o', uint64 x, uint64 y
+//	flag <x> <y>                  'f', uint64 x, uint64 y
+//	chord <x> <y>                 'c', uint64 x, uint64 y
+//	dump                          'd'
+//
+// Text answers are a single line, except for dump, which is followed by a line of cells for every row:
+//	new                           ok
+//	open, flag and chord          <state> <mines left to flag> <n> followed by <x> <y> <cell> for each of the n changed cells
+//	dump                          <state> <mines left to flag> <w> <h>
+//	anything that fails           error <reason>
+//
+// Binary answers start with the state as a byte, or 0xFF if the command failed, which is all a new game answers.
+// Moves follow it with an int64 of mines left to flag, a uint64 n and n times a uint64 cell index and a cell.
+// Dumps follow it with the mines left to flag, the width and the height, and then every cell row by row.
+//
+// A new board can have at most MAX_BOARD_CELLS cells, so every session's board fits into memory even when a server
+// plays many of them. A command that still runs out of memory is answered with an error and ends the game.
+//
+// The state is ready, playing, won or lost (0 to 3 in binary). Cells are '#' closed, 'F' flagged, '.' open without
+// adjacent mines, '1' to '8' open with that many, and after a loss '*' for a mine and 'X' for the one that exploded.
+class BoardSession
+{
+public:
+	enum Framing : uint8_t
+	{
+		TEXT,
+		BINARY
+	};
+
+	explicit BoardSession(Framing framing);
+
+	// Runs every whole command at the start of the input, and appends their answers to the output.
+	// Returns how many bytes of the input were used, a command that's cut off is left for the next call
+	size_t ProcessCommands(std::span<const char> input, std::string& output);
+
+	static constexpr uint8_t BINARY_ERROR = 0xFF;
+	static constexpr uint64_t MAX_BOARD_CELLS = uint64_t{1} << 28; // 192 MiB, at three quarters of a byte per cell
+
+private:
+	enum State : uint8_t
+	{
+		READY,
+		PLAYING,
+		WON,
+		LOST
+	};
+
+	static constexpr size_t BINARY_NEW_GAME_SIZE = 1 + sizeof(uint32_t) + sizeof(uint64_t) * 3;
+	static constexpr size_t BINARY_MOVE_SIZE = 1 + sizeof(uint64_t) * 2;
+
+	const Framing framing;
+	std::unique_ptr<Board> board = nullptr;
+
+	[[nodiscard]] size_t GetCommandSize(std::span<const char> input) const; // Returns 0 if the command is cut off
+	void ProcessTextCommand(std::string_view line, std::string& output);
+	void ProcessBinaryCommand(std::span<const char> frame, std::string& output);
+
+	void NewGame(uint32_t seed, uint64_t width, uint64_t height, uint64_t mines, std::string& output);
+	void PlayMove(const BoardMove& move, std::string& output);
+	void Dump(std::string& output) const;
+	void AppendError(std::string_view reason, std::string& output) const;
+
+	[[nodiscard]] State GetState() const;
+	[[nodiscard]] char GetCellCharacter(const size_t& cellIndex) const;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+// Plays many games at once against a SessionServer that uses text commands, and reports how many moves it answered
+// a second and how long the answers took. Every connection keeps a few commands on the way like a bot that doesn't
+// wait for each answer, so the latency includes the time a command waits behind the ones sent before it.
+// Linux only
+class LoadGenerator
+{
+public:
+	LoadGenerator(std::string socketPath, size_t connectionsAmount, size_t threadsAmount, uint64_t movesPerConnection);
+	LoadGenerator(const LoadGenerator& other) = delete;
+	LoadGenerator& operator=(const LoadGenerator& other) = delete;
+
+	// Returns false if the server couldn't be reached or closed a connection before every move was answered
+	[[nodiscard]] bool Run();
+
+private:
+	static constexpr size_t PIPELINE_DEPTH = 8;
+	static constexpr uint64_t MOVES_PER_GAME = 50;
+	static constexpr uint64_t BOARD_WIDTH = 30;
+	static constexpr uint64_t BOARD_HEIGHT = 16;
+	static constexpr uint64_t BOARD_MINES = 99;
+	static constexpr size_t MAX_LATENCY_MICROSECONDS = 1'000'000; // Slower answers are all counted as this
+
+	struct Client
+	{
+		int socket = -1;
+		std::mt19937 random;
+		uint64_t commandsToSend = 0;
+		uint64_t commandsSent = 0;
+		uint64_t answersReceived = 0;
+		bool isAtLineStart = true;
+		std::array<std::chrono::steady_clock::time_point, PIPELINE_DEPTH> sendTimes{};
+	};
+
+	struct Results
+	{
+		std::vector<uint64_t> latencyCounts = std::vector<uint64_t>(MAX_LATENCY_MICROSECONDS + 1); // In microseconds
+		uint64_t movesAnswered = 0;
+		uint64_t errorsAnswered = 0;
+		bool isServerLost = false;
+	};
+
+	const std::string socketPath;
+	const size_t connectionsAmount;
+	const size_t threadsAmount;
+	const uint64_t movesPerConnection;
+
+	[[nodiscard]] bool ConnectClients(std::vector<Client>& clients) const;
+	static void RunThread(std::span<Client> clients, Results& results);
+	static void StopClient(Client& client);
+	static void ReadAnswers(Client& client, std::span<const char> answers, Results& results);
+	static void SendCommands(Client& client, uint64_t amount, std::string& commands);
+
+	static void PrintReport(const Results& results, std::chrono::steady_clock::duration duration);
+	[[nodiscard]] static double GetPercentileMilliseconds(const std::vector<uint64_t>& latencyCounts, double fraction);
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "board_session.h"
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Hosts a BoardSession for every connection to a Unix domain socket, so many bots can play at the same time.
+// A few workers each wait on their own epoll for the connections they accepted, and a connection stays with the
+// worker that accepted it, so a session is only ever used by one thread and nothing has to be locked.
+// The buffers of a connection are made when it connects, so answering moves doesn't allocate.
+// Linux only
+class SessionServer
+{
+public:
+	SessionServer(std::string socketPath, BoardSession::Framing framing, size_t workersAmount);
+	SessionServer(const SessionServer& other) = delete;
+	SessionServer& operator=(const SessionServer& other) = delete;
+
+	// Serves until the process gets SIGINT or SIGTERM. Returns false if the socket couldn't be opened
+	[[nodiscard]] bool Run();
+
+private:
+	struct Connection
+	{
+		explicit Connection(int socket, BoardSession::Framing framing);
+
+		int socket;
+		BoardSession session;
+		std::vector<char> input; // A command that doesn't fit closes the connection
+		size_t inputSize = 0;
+		std::string output;
+		size_t outputSent = 0;
+		bool isWaitingToWrite = false;
+	};
+
+	static constexpr size_t CONNECTION_BUFFER_SIZE = 1 << 16;
+	static constexpr int MAX_EVENTS = 256;
+
+	const std::string socketPath;
+	const BoardSession::Framing framing;
+	const size_t workersAmount;
+	int listeningSocket = -1;
+	int stopEvent = -1;
+
+	[[nodiscard]] bool OpenSocket();
+	void CloseSocket();
+
+	void RunWorker() const;
+	void AcceptConnections(int epoll, std::unordered_map<int, Connection>& connections) const;
+	[[nodiscard]] static bool ReadCommands(Connection& connection);
+	[[nodiscard]] static bool WriteAnswers(Connection& connection);
+};
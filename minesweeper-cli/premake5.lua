@@ -0,0 +1,24 @@
+
+baseName = path.getbasename(os.getcwd());
+
+-- Plays boards from commands on stdin or a Unix domain socket, with no window. The board itself is built from the game's own sources
+project (baseName)
+	kind "ConsoleApp"
+	location "../_build"
+	targetdir "../_bin/%{cfg.buildcfg}"
+
+	-- The board's debug messages are written to stdout, which is where the answers to the commands go
+	filter "configurations:Debug"
+		undefines { "DEBUG" }
+	filter {}
+
+	vpaths
+	{
+	  ["Header Files/*"] = { "include/**.h", "../minesweeper-raylib/include/**.h"},
+	  ["Source Files/*"] = { "src/**.cpp", "../minesweeper-raylib/src/**.cpp"},
+	}
+	files {"src/**.cpp", "include/**.h", "../minesweeper-raylib/src/**.cpp", "../minesweeper-raylib/include/**.h"}
+	removefiles {"../minesweeper-raylib/src/main.cpp"}
+
+	includedirs { "./", "src", "include", "../minesweeper-raylib/include"}
+	link_raylib();
@@ -0,0 +1,423 @@
+#include "board_session.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <new>
+
+
+namespace
+{
+	constexpr std::array<std::string_view, 4> STATE_NAMES{"ready", "playing", "won", "lost"};
+
+	template <typename T>
+	void AppendNumber(const T value, std::string& output)
+	{
+		std::array<char, 24> digits{};
+		const auto [end, error] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+		output.append(digits.data(), end);
+	}
+
+	template <typename T>
+	void AppendBinary(const T value, std::string& output)
+	{
+		output.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	T ReadBinary(const std::span<const char> input, const size_t offset)
+	{
+		T value;
+		std::memcpy(&value, input.data() + offset, sizeof(T));
+		return value;
+	}
+}
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+BoardSession::BoardSession(const Framing framing)
+	: framing(framing)
+{
+}
+
+size_t BoardSession::ProcessCommands(const std::span<const char> input, std::string& output)
+{
+	size_t usedBytes = 0;
+	while (usedBytes < input.size())
+	{
+		const std::span<const char> unusedInput = input.subspan(usedBytes);
+		const size_t commandSize = GetCommandSize(unusedInput);
+		if (commandSize == 0)
+		{
+			break;
+		}
+
+		const size_t answerStart = output.size();
+		try
+		{
+			if (framing == BINARY)
+			{
+				ProcessBinaryCommand(unusedInput.first(commandSize), output);
+			}
+			else
+			{
+				ProcessTextCommand(std::string_view(unusedInput.data(), commandSize - 1), output);
+			}
+		}
+		catch (const std::bad_alloc&)
+		{
+			// Boards are kept small enough to fit, but a move that runs out of memory halfway leaves the board
+			// in a state no other command can be played on, so the game is dropped and only the error is answered
+			board = nullptr;
+			output.resize(answerStart);
+			AppendError("out of memory, the game was ended", output);
+		}
+
+		usedBytes += commandSize;
+	}
+
+	return usedBytes;
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+void BoardSession::ProcessTextCommand(std::string_view line, std::string& output)
+{
+	if (!line.empty() && line.back() == '\r')
+	{
+		line.remove_suffix(1);
+	}
+
+	std::array<std::string_view, 6> words{};
+	size_t wordsAmount = 0;
+	while (!line.empty())
+	{
+		const size_t wordStart = line.find_first_not_of(' ');
+		if (wordStart == std::string_view::npos)
+		{
+			break;
+		}
+
+		line.remove_prefix(wordStart);
+		const size_t wordEnd = std::min(line.find(' '), line.size());
+
+		if (wordsAmount == words.size())
+		{
+			AppendError("too many arguments", output);
+			return;
+		}
+
+		words[wordsAmount++] = line.substr(0, wordEnd);
+		line.remove_prefix(wordEnd);
+	}
+
+	// Empty lines aren't commands, so they don't get an answer either
+	if (wordsAmount == 0)
+	{
+		return;
+	}
+
+	std::array<uint64_t, 5> numbers{};
+	for (size_t i = 1; i < wordsAmount; ++i)
+	{
+		const std::string_view word = words[i];
+		if (const auto [end, error] = std::from_chars(word.data(), word.data() + word.size(), numbers[i - 1]);
+			error != std::errc{} || end != word.data() + word.size())
+		{
+			AppendError("arguments have to be whole numbers", output);
+			return;
+		}
+	}
+
+	const std::string_view command = words[0];
+	const size_t argumentsAmount = wordsAmount - 1;
+
+	if (command == "new" && argumentsAmount == 4)
+	{
+		if (numbers[0] > UINT32_MAX)
+		{
+			AppendError("the seed has to fit in 32 bits", output);
+			return;
+		}
+
+		NewGame(static_cast<uint32_t>(numbers[0]), numbers[1], numbers[2], numbers[3], output);
+	}
+	else if (command == "open" && argumentsAmount == 2)
+	{
+		PlayMove(BoardMove{BoardMove::OPEN, numbers[0], numbers[1]}, output);
+	}
+	else if (command == "flag" && argumentsAmount == 2)
+	{
+		PlayMove(BoardMove{BoardMove::FLAG, numbers[0], numbers[1]}, output);
+	}
+	else if (command == "chord" && argumentsAmount == 2)
+	{
+		PlayMove(BoardMove{BoardMove::CHORD, numbers[0], numbers[1]}, output);
+	}
+	else if (command == "dump" && argumentsAmount == 0)
+	{
+		Dump(output);
+	}
+	else
+	{
+		AppendError("unknown command", output);
+	}
+}
+
+// Text commands end with their line, binary frames are as long as their type says
+size_t BoardSession::GetCommandSize(const std::span<const char> input) const
+{
+	if (framing == TEXT)
+	{
+		const auto lineEnd = std::find(input.begin(), input.end(), '\n');
+		return lineEnd == input.end() ? 0 : static_cast<size_t>(lineEnd - input.begin()) + 1;
+	}
+
+	size_t frameSize = 1;
+	switch (input[0])
+	{
+	case 'n':
+		frameSize = BINARY_NEW_GAME_SIZE;
+		break;
+	case 'o':
+	case 'f':
+	case 'c':
+		frameSize = BINARY_MOVE_SIZE;
+		break;
+	default:
+		// Dumps are a single byte. There's no telling where the next frame starts after an unknown byte,
+		// so the bytes are answered one by one until one makes sense
+		break;
+	}
+
+	return input.size() < frameSize ? 0 : frameSize;
+}
+
+void BoardSession::ProcessBinaryCommand(const std::span<const char> frame, std::string& output)
+{
+	const auto readMove = [frame](const BoardMove::Type type)
+	{
+		return BoardMove{type, ReadBinary<uint64_t>(frame, 1), ReadBinary<uint64_t>(frame, 1 + sizeof(uint64_t))};
+	};
+
+	switch (frame[0])
+	{
+	case 'n':
+		NewGame(
+			ReadBinary<uint32_t>(frame, 1),
+			ReadBinary<uint64_t>(frame, 1 + sizeof(uint32_t)),
+			ReadBinary<uint64_t>(frame, 1 + sizeof(uint32_t) + sizeof(uint64_t)),
+			ReadBinary<uint64_t>(frame, 1 + sizeof(uint32_t) + sizeof(uint64_t) * 2),
+			output
+		);
+		break;
+	case 'o':
+	case 'f':
+	case 'c':
+		PlayMove(readMove(frame[0] == 'o' ? BoardMove::OPEN : frame[0] == 'f' ? BoardMove::FLAG : BoardMove::CHORD), output);
+		break;
+	case 'd':
+		Dump(output);
+		break;
+	default:
+		AppendError("unknown command", output);
+		break;
+	}
+}
+
+void BoardSession::NewGame(const uint32_t seed, const uint64_t width, const uint64_t height, const uint64_t mines, std::string& output)
+{
+	if (width == 0 || height == 0 || width > MAX_BOARD_CELLS / height)
+	{
+		AppendError("the board has to have between 1 and 268435456 cells", output);
+		return;
+	}
+
+	if (mines > width * height)
+	{
+		AppendError("the board cannot have more mines than cells", output);
+		return;
+	}
+
+	// Bots mostly play the same kind of board over and over, which is just cleared, so a new game doesn't allocate.
+	// Otherwise the previous board is freed first, so two huge boards never have to fit in memory at once
+	if (board != nullptr && board->GetWidth() == width && board->GetHeight() == height && board->GetMaxMines() == mines)
+	{
+		// The clear is a tick of its own, so it isn't reported along with the first move
+		board->Reset();
+		board->EndTick();
+	}
+	else
+	{
+		board = nullptr;
+		board = std::make_unique<Board>(Vec2<int>{0}, 1, static_cast<size_t>(width), static_cast<size_t>(height), mines, false);
+	}
+	board->SetSeed(seed);
+
+	if (framing == TEXT)
+	{
+		output += "ok\n";
+	}
+	else
+	{
+		AppendBinary(static_cast<uint8_t>(READY), output);
+	}
+}
+
+// A move on a game that's already over changes nothing, which is answered like any other move
+void BoardSession::PlayMove(const BoardMove& move, std::string& output)
+{
+	if (board == nullptr)
+	{
+		AppendError("no game has been started", output);
+		return;
+	}
+
+	if (move.x >= board->GetWidth() || move.y >= board->GetHeight())
+	{
+		AppendError("the cell is not on the board", output);
+		return;
+	}
+
+	board->PlayMove(move);
+	board->EndTick();
+
+	const BoardTickChanges tickChanges = board->GetTickChanges();
+	const size_t width = board->GetWidth();
+
+	if (framing == BINARY)
+	{
+		AppendBinary(static_cast<uint8_t>(GetState()), output);
+		AppendBinary(board->GetMinesLeftToFlag(), output);
+		AppendBinary(static_cast<uint64_t>(tickChanges.GetChangedCellsAmount()), output);
+		tickChanges.ForEachChangedCell([&output, this](const size_t cellIndex)
+		{
+			AppendBinary(static_cast<uint64_t>(cellIndex), output);
+			AppendBinary(this->GetCellCharacter(cellIndex), output);
+		});
+
+		return;
+	}
+
+	output += STATE_NAMES[GetState()];
+	output += ' ';
+	AppendNumber(board->GetMinesLeftToFlag(), output);
+	output += ' ';
+	AppendNumber(tickChanges.GetChangedCellsAmount(), output);
+	tickChanges.ForEachChangedCell([&output, width, this](const size_t cellIndex)
+	{
+		output += ' ';
+		AppendNumber(cellIndex % width, output);
+		output += ' ';
+		AppendNumber(cellIndex / width, output);
+		output += ' ';
+		output += this->GetCellCharacter(cellIndex);
+	});
+	output += '\n';
+}
+
+void BoardSession::Dump(std::string& output) const
+{
+	if (board == nullptr)
+	{
+		AppendError("no game has been started", output);
+		return;
+	}
+
+	const size_t width = board->GetWidth();
+	const size_t height = board->GetHeight();
+
+	if (framing == BINARY)
+	{
+		AppendBinary(static_cast<uint8_t>(GetState()), output);
+		AppendBinary(board->GetMinesLeftToFlag(), output);
+		AppendBinary(static_cast<uint64_t>(width), output);
+		AppendBinary(static_cast<uint64_t>(height), output);
+	}
+	else
+	{
+		output += STATE_NAMES[GetState()];
+		output += ' ';
+		AppendNumber(board->GetMinesLeftToFlag(), output);
+		output += ' ';
+		AppendNumber(width, output);
+		output += ' ';
+		AppendNumber(height, output);
+		output += '\n';
+	}
+
+	for (size_t y = 0; y < height; ++y)
+	{
+		for (size_t x = 0; x < width; ++x)
+		{
+			output += GetCellCharacter(y * width + x);
+		}
+
+		if (framing == TEXT)
+		{
+			output += '\n';
+		}
+	}
+}
+
+void BoardSession::AppendError(const std::string_view reason, std::string& output) const
+{
+	if (framing == BINARY)
+	{
+		AppendBinary(BINARY_ERROR, output);
+		return;
+	}
+
+	output += "error ";
+	output += reason;
+	output += '\n';
+}
+
+BoardSession::State BoardSession::GetState() const
+{
+	switch (board->GetOutcome())
+	{
+	case BoardSprite::WON:
+		return WON;
+	case BoardSprite::LOST:
+		return LOST;
+	default:
+		return board->IsGameInProgress() ? PLAYING : READY;
+	}
+}
+
+// Mines are only shown once the game is lost, like on the screen
+char BoardSession::GetCellCharacter(const size_t& cellIndex) const
+{
+	using namespace BoardSprite;
+
+	const uint8_t spriteKey = board->GetCellSpriteKey(cellIndex);
+	const Outcome outcome = board->GetOutcome();
+
+	if (spriteKey >= KEY_OPEN)
+	{
+		return spriteKey == KEY_OPEN ? '.' : static_cast<char>('0' + spriteKey - KEY_OPEN);
+	}
+
+	// Every cell that's still closed once the game is won has a mine, so they're all shown flagged
+	if (spriteKey & KEY_FLAGGED || outcome == BoardSprite::WON)
+	{
+		return 'F';
+	}
+
+	if (outcome == BoardSprite::LOST && spriteKey & KEY_MINE)
+	{
+		return spriteKey & KEY_EXPLODED ? 'X' : '*';
+	}
+
+	return '#';
+}
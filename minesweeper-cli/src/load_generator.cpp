@@ -0,0 +1,357 @@
+#if defined __linux__
+
+#include "load_generator.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <utility>
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr size_t RECEIVE_BUFFER_SIZE = 1 << 16;
+
+	// Every game starts with a new command, followed by up to MOVES_PER_GAME moves
+	constexpr bool IsNewGameCommand(const uint64_t commandIndex, const uint64_t movesPerGame)
+	{
+		return commandIndex % (movesPerGame + 1) == 0;
+	}
+}
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+LoadGenerator::LoadGenerator(std::string socketPath, const size_t connectionsAmount, const size_t threadsAmount, const uint64_t movesPerConnection)
+	: socketPath(std::move(socketPath)),
+	connectionsAmount(std::max<size_t>(connectionsAmount, 1)),
+	threadsAmount(std::clamp<size_t>(threadsAmount, 1, std::max<size_t>(connectionsAmount, 1))),
+	movesPerConnection(movesPerConnection)
+{
+}
+
+bool LoadGenerator::Run()
+{
+	std::vector<Client> clients(connectionsAmount);
+	if (!ConnectClients(clients))
+	{
+		for (Client& client : clients)
+		{
+			StopClient(client);
+		}
+		return false;
+	}
+
+	std::vector<Results> threadResults(threadsAmount);
+	std::vector<std::thread> threads;
+	threads.reserve(threadsAmount);
+
+	const Clock::time_point startTime = Clock::now();
+
+	// The connections are split as evenly as they go, the first threads take the ones left over
+	size_t firstClient = 0;
+	for (size_t i = 0; i < threadsAmount; ++i)
+	{
+		const size_t clientsAmount = connectionsAmount / threadsAmount + (i < connectionsAmount % threadsAmount ? 1 : 0);
+		threads.emplace_back(RunThread, std::span<Client>(clients).subspan(firstClient, clientsAmount), std::ref(threadResults[i]));
+		firstClient += clientsAmount;
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	const Clock::duration duration = Clock::now() - startTime;
+
+	Results results;
+	for (const Results& threadResult : threadResults)
+	{
+		for (size_t i = 0; i < results.latencyCounts.size(); ++i)
+		{
+			results.latencyCounts[i] += threadResult.latencyCounts[i];
+		}
+
+		results.movesAnswered += threadResult.movesAnswered;
+		results.errorsAnswered += threadResult.errorsAnswered;
+		results.isServerLost |= threadResult.isServerLost;
+	}
+
+	PrintReport(results, duration);
+	return !results.isServerLost;
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+bool LoadGenerator::ConnectClients(std::vector<Client>& clients) const
+{
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (socketPath.size() >= sizeof(address.sun_path))
+	{
+		std::cerr << "The socket path " << socketPath << " is too long\n";
+		return false;
+	}
+	std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+	const uint64_t gamesPerConnection = (movesPerConnection + MOVES_PER_GAME - 1) / MOVES_PER_GAME;
+
+	for (size_t i = 0; i < clients.size(); ++i)
+	{
+		Client& client = clients[i];
+		client.random.seed(static_cast<uint32_t>(i));
+		client.commandsToSend = movesPerConnection + gamesPerConnection;
+
+		// The sockets block, a client never has more than a few short commands on the way, so sending doesn't wait
+		client.socket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (client.socket < 0 || connect(client.socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0)
+		{
+			std::cerr << "Could not connect to " << socketPath << ": " << std::strerror(errno) << "\n";
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void LoadGenerator::RunThread(const std::span<Client> clients, Results& results)
+{
+	const int epoll = epoll_create1(EPOLL_CLOEXEC);
+	if (epoll < 0)
+	{
+		results.isServerLost = true;
+		return;
+	}
+
+	std::string commands;
+	std::vector<char> answers(RECEIVE_BUFFER_SIZE);
+	size_t clientsPlaying = 0;
+
+	for (size_t i = 0; i < clients.size(); ++i)
+	{
+		Client& client = clients[i];
+		if (client.commandsToSend == 0)
+		{
+			StopClient(client);
+			continue;
+		}
+
+		epoll_event event{};
+		event.events = EPOLLIN;
+		event.data.u64 = i;
+		epoll_ctl(epoll, EPOLL_CTL_ADD, client.socket, &event);
+
+		SendCommands(client, PIPELINE_DEPTH, commands);
+		++clientsPlaying;
+	}
+
+	std::vector<epoll_event> events(std::max<size_t>(clientsPlaying, 1));
+
+	while (clientsPlaying > 0)
+	{
+		const int eventsAmount = epoll_wait(epoll, events.data(), static_cast<int>(events.size()), -1);
+		if (eventsAmount < 0 && errno != EINTR)
+		{
+			results.isServerLost = true;
+			break;
+		}
+
+		for (int i = 0; i < eventsAmount; ++i)
+		{
+			Client& client = clients[events[i].data.u64];
+
+			const ssize_t receivedBytes = recv(client.socket, answers.data(), answers.size(), 0);
+			if (receivedBytes <= 0)
+			{
+				if (receivedBytes < 0 && errno == EINTR)
+				{
+					continue;
+				}
+
+				std::cerr << "The server closed a connection after " << client.answersReceived << " answers\n";
+				results.isServerLost = true;
+				StopClient(client);
+				--clientsPlaying;
+				continue;
+			}
+
+			const uint64_t previousAnswersReceived = client.answersReceived;
+			ReadAnswers(client, {answers.data(), static_cast<size_t>(receivedBytes)}, results);
+
+			// Every answer makes room for one more command on the way
+			SendCommands(client, client.answersReceived - previousAnswersReceived, commands);
+
+			if (client.answersReceived == client.commandsToSend)
+			{
+				StopClient(client);
+				--clientsPlaying;
+			}
+		}
+	}
+
+	// The connections are left unfinished if waiting for the server failed
+	for (Client& client : clients)
+	{
+		StopClient(client);
+	}
+
+	close(epoll);
+}
+
+void LoadGenerator::StopClient(Client& client)
+{
+	if (client.socket >= 0)
+	{
+		close(client.socket);
+		client.socket = -1;
+	}
+}
+
+// Every answer that's used here is a single line, so each line break is the end of the answer to the oldest command
+void LoadGenerator::ReadAnswers(Client& client, const std::span<const char> answers, Results& results)
+{
+	const Clock::time_point receiveTime = Clock::now();
+
+	for (const char character : answers)
+	{
+		if (client.isAtLineStart && character == 'e')
+		{
+			++results.errorsAnswered;
+		}
+		client.isAtLineStart = character == '\n';
+
+		if (!client.isAtLineStart)
+		{
+			continue;
+		}
+
+		if (!IsNewGameCommand(client.answersReceived, MOVES_PER_GAME))
+		{
+			const Clock::duration latency = receiveTime - client.sendTimes[client.answersReceived % PIPELINE_DEPTH];
+			const auto microseconds = static_cast<size_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+
+			++results.latencyCounts[std::min(microseconds, MAX_LATENCY_MICROSECONDS)];
+			++results.movesAnswered;
+		}
+
+		++client.answersReceived;
+	}
+}
+
+void LoadGenerator::SendCommands(Client& client, const uint64_t amount, std::string& commands)
+{
+	commands.clear();
+
+	const uint64_t lastCommand = std::min(client.commandsSent + amount, client.commandsToSend);
+	const Clock::time_point sendTime = Clock::now();
+
+	for (; client.commandsSent < lastCommand; ++client.commandsSent)
+	{
+		client.sendTimes[client.commandsSent % PIPELINE_DEPTH] = sendTime;
+
+		if (IsNewGameCommand(client.commandsSent, MOVES_PER_GAME))
+		{
+			commands += "new ";
+			commands += std::to_string(client.random());
+			commands += ' ';
+			commands += std::to_string(BOARD_WIDTH);
+			commands += ' ';
+			commands += std::to_string(BOARD_HEIGHT);
+			commands += ' ';
+			commands += std::to_string(BOARD_MINES);
+			commands += '\n';
+			continue;
+		}
+
+		// Mostly opening cells like a bot would, with some flags and chords in between
+		const uint32_t moveKind = client.random() % 10;
+		commands += moveKind < 7 ? "open " : moveKind < 9 ? "flag " : "chord ";
+		commands += std::to_string(client.random() % BOARD_WIDTH);
+		commands += ' ';
+		commands += std::to_string(client.random() % BOARD_HEIGHT);
+		commands += '\n';
+	}
+
+	size_t sentBytes = 0;
+	while (sentBytes < commands.size())
+	{
+		const ssize_t sent = send(client.socket, commands.data() + sentBytes, commands.size() - sentBytes, MSG_NOSIGNAL);
+		if (sent < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			// The server is gone, which shows up as a closed connection when the answers are read
+			return;
+		}
+
+		sentBytes += static_cast<size_t>(sent);
+	}
+}
+
+void LoadGenerator::PrintReport(const Results& results, const Clock::duration duration)
+{
+	const double seconds = std::chrono::duration<double>(duration).count();
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Answered " << results.movesAnswered << " moves in " << seconds << " s, "
+		<< std::setprecision(0) << static_cast<double>(results.movesAnswered) / seconds << " moves/s\n";
+	std::cout << std::setprecision(3)
+		<< "Latency p50 " << GetPercentileMilliseconds(results.latencyCounts, 0.5) << " ms, "
+		<< "p99 " << GetPercentileMilliseconds(results.latencyCounts, 0.99) << " ms, "
+		<< "max " << GetPercentileMilliseconds(results.latencyCounts, 1.0) << " ms\n";
+
+	if (results.errorsAnswered > 0)
+	{
+		std::cout << results.errorsAnswered << " commands were answered with an error\n";
+	}
+}
+
+// The latencies are counted in whole microseconds, so this is the microsecond the latency falls in
+double LoadGenerator::GetPercentileMilliseconds(const std::vector<uint64_t>& latencyCounts, const double fraction)
+{
+	uint64_t totalCount = 0;
+	for (const uint64_t count : latencyCounts)
+	{
+		totalCount += count;
+	}
+
+	if (totalCount == 0)
+	{
+		return 0.0;
+	}
+
+	const auto neededCount = std::max<uint64_t>(static_cast<uint64_t>(static_cast<double>(totalCount) * fraction + 0.5), 1);
+	uint64_t countSoFar = 0;
+	for (size_t microseconds = 0; microseconds < latencyCounts.size(); ++microseconds)
+	{
+		countSoFar += latencyCounts[microseconds];
+		if (countSoFar >= neededCount)
+		{
+			return static_cast<double>(microseconds) / 1000.0;
+		}
+	}
+
+	return static_cast<double>(MAX_LATENCY_MICROSECONDS) / 1000.0;
+}
+
+#endif
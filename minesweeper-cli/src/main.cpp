@@ -0,0 +1,160 @@
+#include "board_session.h"
+#include "load_generator.h"
+#include "session_server.h"
+
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace
+{
+	constexpr std::string_view USAGE =
+		"Usage: minesweeper-cli [--binary]\n"
+		"       minesweeper-cli --server <socket> [--binary] [--threads <n>]\n"
+		"       minesweeper-cli --load <socket> [--connections <n>] [--moves <n per connection>] [--threads <n>]\n"
+		"Boards can have at most 268435456 cells, see board_session.h for the commands.\n";
+
+	bool ParseNumber(const std::string_view text, uint64_t& number)
+	{
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), number);
+		return error == std::errc{} && end == text.data() + text.size();
+	}
+
+	// Answers the commands on stdin on stdout, see BoardSession for the commands.
+	// Everything that has arrived by the time the last batch is done is run as the next batch, and its answers are
+	// written all at once, so a program that sends many commands before reading the answers is never held up by a
+	// flush for every command
+	int RunStandardStreams(const bool isBinary)
+	{
+#if defined _WIN32
+		// Line endings would be translated otherwise, which breaks binary frames
+		_setmode(_fileno(stdin), _O_BINARY);
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+		// Without this stdin isn't buffered, so there would be nothing to take at once
+		std::ios::sync_with_stdio(false);
+		std::streambuf& input = *std::cin.rdbuf();
+
+		BoardSession session{isBinary ? BoardSession::BINARY : BoardSession::TEXT};
+		std::vector<char> pendingInput;
+		std::string output;
+
+		const auto processPendingInput = [&session, &pendingInput, &output]
+		{
+			const size_t usedBytes = session.ProcessCommands(pendingInput, output);
+			pendingInput.erase(pendingInput.begin(), pendingInput.begin() + static_cast<std::ptrdiff_t>(usedBytes));
+
+			std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+			std::cout.flush();
+			output.clear();
+		};
+
+		// Waiting for the next character fills the input buffer with whatever has arrived, which is then taken at once
+		while (input.sgetc() != std::char_traits<char>::eof())
+		{
+			const auto availableBytes = input.in_avail();
+			const size_t previousSize = pendingInput.size();
+
+			pendingInput.resize(previousSize + static_cast<size_t>(availableBytes));
+			input.sgetn(pendingInput.data() + previousSize, availableBytes);
+
+			processPendingInput();
+		}
+
+		// The last line doesn't need to end with a line break
+		if (!isBinary && !pendingInput.empty())
+		{
+			pendingInput.push_back('\n');
+			processPendingInput();
+		}
+
+		return 0;
+	}
+}
+
+// Plays on stdin and stdout by default. --server hosts a session for every connection to a Unix domain socket
+// instead, and --load plays many games at once against such a server to measure it
+int main(const int argc, char* argv[])
+{
+	bool isBinary = false;
+	std::string serverSocketPath;
+	std::string loadSocketPath;
+	uint64_t threadsAmount = std::max(std::thread::hardware_concurrency() / 2, 1u);
+	uint64_t connectionsAmount = 1000;
+	uint64_t movesPerConnection = 1000;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view argument = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (argument == "--binary")
+		{
+			isBinary = true;
+		}
+		else if (argument == "--server" && hasValue)
+		{
+			serverSocketPath = argv[++i];
+		}
+		else if (argument == "--load" && hasValue)
+		{
+			loadSocketPath = argv[++i];
+		}
+		else if (argument == "--threads" || argument == "--connections" || argument == "--moves")
+		{
+			uint64_t& number = argument == "--threads" ? threadsAmount : argument == "--connections" ? connectionsAmount : movesPerConnection;
+			if (!hasValue || !ParseNumber(argv[++i], number))
+			{
+				std::cerr << USAGE;
+				return 1;
+			}
+		}
+		else
+		{
+			std::cerr << USAGE;
+			return 1;
+		}
+	}
+
+	if (serverSocketPath.empty() && loadSocketPath.empty())
+	{
+		return RunStandardStreams(isBinary);
+	}
+
+	if (!serverSocketPath.empty() && !loadSocketPath.empty())
+	{
+		std::cerr << USAGE;
+		return 1;
+	}
+
+#if defined __linux__
+	if (!serverSocketPath.empty())
+	{
+		SessionServer server{serverSocketPath, isBinary ? BoardSession::BINARY : BoardSession::TEXT, threadsAmount};
+		return server.Run() ? 0 : 1;
+	}
+
+	// The load generator only speaks text
+	if (isBinary)
+	{
+		std::cerr << USAGE;
+		return 1;
+	}
+
+	LoadGenerator loadGenerator{loadSocketPath, connectionsAmount, threadsAmount, movesPerConnection};
+	return loadGenerator.Run() ? 0 : 1;
+#else
+	std::cerr << "The server and the load generator only run on Linux\n";
+	return 1;
+#endif
+}
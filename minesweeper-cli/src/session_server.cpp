@@ -0,0 +1,325 @@
+#if defined __linux__
+
+#include "session_server.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <utility>
+
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+namespace
+{
+	void PrintSystemError(const std::string_view what)
+	{
+		std::cerr << what << ": " << std::strerror(errno) << "\n";
+	}
+
+	void WatchSocket(const int epoll, const int socket, const uint32_t events, const int operation = EPOLL_CTL_ADD)
+	{
+		epoll_event event{};
+		event.events = events;
+		event.data.fd = socket;
+		epoll_ctl(epoll, operation, socket, &event);
+	}
+}
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+SessionServer::SessionServer(std::string socketPath, const BoardSession::Framing framing, const size_t workersAmount)
+	: socketPath(std::move(socketPath)), framing(framing), workersAmount(std::max<size_t>(workersAmount, 1))
+{
+}
+
+bool SessionServer::Run()
+{
+	// The signals are blocked before the workers are started, so they're only ever taken by sigwait below
+	sigset_t stopSignals;
+	sigemptyset(&stopSignals);
+	sigaddset(&stopSignals, SIGINT);
+	sigaddset(&stopSignals, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+
+	if (!OpenSocket())
+	{
+		CloseSocket();
+		return false;
+	}
+
+	std::cout << "Serving " << workersAmount << " workers on " << socketPath << ", stop with Ctrl+C\n";
+	std::cout.flush();
+
+	std::vector<std::thread> workers;
+	workers.reserve(workersAmount);
+	for (size_t i = 0; i < workersAmount; ++i)
+	{
+		workers.emplace_back(&SessionServer::RunWorker, this);
+	}
+
+	int signal = 0;
+	sigwait(&stopSignals, &signal);
+
+	// The event is never read, so it wakes up every worker
+	constexpr uint64_t stop = 1;
+	write(stopEvent, &stop, sizeof(stop));
+
+	for (std::thread& worker : workers)
+	{
+		worker.join();
+	}
+
+	CloseSocket();
+	return true;
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+SessionServer::Connection::Connection(const int socket, const BoardSession::Framing framing)
+	: socket(socket), session(framing), input(CONNECTION_BUFFER_SIZE)
+{
+	output.reserve(CONNECTION_BUFFER_SIZE);
+}
+
+bool SessionServer::OpenSocket()
+{
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (socketPath.size() >= sizeof(address.sun_path))
+	{
+		std::cerr << "The socket path " << socketPath << " is too long\n";
+		return false;
+	}
+	std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+	listeningSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (listeningSocket < 0)
+	{
+		PrintSystemError("Could not make the socket");
+		return false;
+	}
+
+	// A socket left behind by a server that didn't stop cleanly would make binding fail
+	unlink(socketPath.c_str());
+
+	if (bind(listeningSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0)
+	{
+		PrintSystemError("Could not bind " + socketPath);
+		return false;
+	}
+
+	if (listen(listeningSocket, SOMAXCONN) < 0)
+	{
+		PrintSystemError("Could not listen on " + socketPath);
+		return false;
+	}
+
+	stopEvent = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (stopEvent < 0)
+	{
+		PrintSystemError("Could not make the stop event");
+		return false;
+	}
+
+	return true;
+}
+
+void SessionServer::CloseSocket()
+{
+	if (listeningSocket >= 0)
+	{
+		close(listeningSocket);
+		unlink(socketPath.c_str());
+		listeningSocket = -1;
+	}
+
+	if (stopEvent >= 0)
+	{
+		close(stopEvent);
+		stopEvent = -1;
+	}
+}
+
+void SessionServer::RunWorker() const
+{
+	const int epoll = epoll_create1(EPOLL_CLOEXEC);
+	if (epoll < 0)
+	{
+		PrintSystemError("Could not make a worker's epoll");
+		return;
+	}
+
+	// Every worker waits for new connections, EPOLLEXCLUSIVE wakes up only one of them for each
+	WatchSocket(epoll, listeningSocket, EPOLLIN | EPOLLEXCLUSIVE);
+	WatchSocket(epoll, stopEvent, EPOLLIN);
+
+	std::unordered_map<int, Connection> connections;
+	std::array<epoll_event, MAX_EVENTS> events{};
+	bool isStopping = false;
+
+	while (!isStopping)
+	{
+		const int eventsAmount = epoll_wait(epoll, events.data(), MAX_EVENTS, -1);
+		if (eventsAmount < 0 && errno != EINTR)
+		{
+			PrintSystemError("A worker could not wait for its connections");
+			break;
+		}
+
+		for (int i = 0; i < eventsAmount; ++i)
+		{
+			const epoll_event& event = events[i];
+
+			if (event.data.fd == stopEvent)
+			{
+				isStopping = true;
+				break;
+			}
+
+			if (event.data.fd == listeningSocket)
+			{
+				AcceptConnections(epoll, connections);
+				continue;
+			}
+
+			const auto found = connections.find(event.data.fd);
+			if (found == connections.end())
+			{
+				continue;
+			}
+
+			Connection& connection = found->second;
+
+			// Answers that are still waiting to be sent go first, the commands after them are read once they're out
+			bool isOpen = (event.events & EPOLLERR) == 0;
+			if (isOpen && event.events & EPOLLOUT)
+			{
+				isOpen = WriteAnswers(connection);
+			}
+			if (isOpen && event.events & (EPOLLIN | EPOLLHUP))
+			{
+				isOpen = ReadCommands(connection);
+			}
+
+			if (!isOpen)
+			{
+				close(connection.socket);
+				connections.erase(found);
+				continue;
+			}
+
+			// A client that doesn't read its answers isn't read from either, until it has caught up
+			if (const bool hasUnsentAnswers = connection.outputSent < connection.output.size();
+				hasUnsentAnswers != connection.isWaitingToWrite)
+			{
+				connection.isWaitingToWrite = hasUnsentAnswers;
+				WatchSocket(epoll, connection.socket, hasUnsentAnswers ? EPOLLOUT : EPOLLIN, EPOLL_CTL_MOD);
+			}
+		}
+	}
+
+	for (const auto& [socket, connection] : connections)
+	{
+		close(socket);
+	}
+	close(epoll);
+}
+
+void SessionServer::AcceptConnections(const int epoll, std::unordered_map<int, Connection>& connections) const
+{
+	while (true)
+	{
+		const int socket = accept4(listeningSocket, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (socket < 0)
+		{
+			// EAGAIN once every waiting connection is taken, or another worker took it first
+			if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+			{
+				PrintSystemError("Could not accept a connection");
+			}
+			return;
+		}
+
+		connections.try_emplace(socket, socket, framing);
+		WatchSocket(epoll, socket, EPOLLIN);
+	}
+}
+
+// Returns false once the connection should be closed
+bool SessionServer::ReadCommands(Connection& connection)
+{
+	const ssize_t receivedBytes = recv(
+		connection.socket,
+		connection.input.data() + connection.inputSize,
+		connection.input.size() - connection.inputSize,
+		0
+	);
+
+	if (receivedBytes == 0)
+	{
+		return false;
+	}
+
+	if (receivedBytes < 0)
+	{
+		return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+	}
+
+	connection.inputSize += static_cast<size_t>(receivedBytes);
+
+	const size_t usedBytes = connection.session.ProcessCommands({connection.input.data(), connection.inputSize}, connection.output);
+	connection.inputSize -= usedBytes;
+	std::memmove(connection.input.data(), connection.input.data() + usedBytes, connection.inputSize);
+
+	if (connection.inputSize == connection.input.size())
+	{
+		return false;
+	}
+
+	return WriteAnswers(connection);
+}
+
+// Sends as much of the answers as the socket takes, returns false once the connection should be closed
+bool SessionServer::WriteAnswers(Connection& connection)
+{
+	while (connection.outputSent < connection.output.size())
+	{
+		const ssize_t sentBytes = send(
+			connection.socket,
+			connection.output.data() + connection.outputSent,
+			connection.output.size() - connection.outputSent,
+			MSG_NOSIGNAL
+		);
+
+		if (sentBytes < 0)
+		{
+			return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+		}
+
+		connection.outputSent += static_cast<size_t>(sentBytes);
+	}
+
+	connection.output.clear();
+	connection.outputSent = 0;
+	return true;
+}
+
+#endif
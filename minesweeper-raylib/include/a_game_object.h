@@ -12,6 +12,9 @@ protected:
 	virtual void Draw() const = 0;
 	virtual void Reset() = 0;
 
+	// Moves and rescales the object when the window layout changes, without touching any of its other state
+	void SetLayout(const Vec2<int>& screenPos, const int& cellSize);
+
 	Vec2<int> screenPositionPixels;
-	const int cellSizePixels;
+	int cellSizePixels;
 };
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+
+// Counts every heap allocation made through the global operator new.
+// The counting hook is only compiled into debug builds, in release builds the count always stays at 0.
+namespace AllocationTracker
+{
+	[[nodiscard]] size_t GetAllocationCount();
+
+	// Allocations made on this thread while an instance is alive are expected and don't get counted,
+	// e.g. writing a save file or growing the undo history
+	class ScopedAllowance
+	{
+	public:
+		ScopedAllowance();
+		~ScopedAllowance();
+		ScopedAllowance(const ScopedAllowance&) = delete;
+		ScopedAllowance& operator=(const ScopedAllowance&) = delete;
+	};
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// A bit for every cell of a board, cell i being bit i % 64 of word i / 64. The board keeps each part of a cell's
+// state in a plane of its own, so a cell takes a few bits instead of a byte, and a whole word of cells can be
+// looked at in one go. The bits past the last cell are always 0, so they never show up in counts.
+class BitPlane
+{
+public:
+	BitPlane() = default;
+
+	explicit BitPlane(const size_t bitsAmount)
+		: words(GetWordsAmount(bitsAmount), 0),
+		  size(bitsAmount)
+	{
+	}
+
+	[[nodiscard]] static constexpr size_t GetWordsAmount(const size_t bitsAmount) { return bitsAmount / 64 + (bitsAmount % 64 != 0); }
+	[[nodiscard]] static constexpr uint64_t GetBytes(const size_t bitsAmount) { return GetWordsAmount(bitsAmount) * sizeof(uint64_t); }
+
+	[[nodiscard]] bool Test(const size_t index) const
+	{
+		assert(index < size && "Bit is out of the plane's range");
+		return (words[index / 64] >> (index % 64) & 1) != 0;
+	}
+
+	void Set(const size_t index)
+	{
+		assert(index < size && "Bit is out of the plane's range");
+		words[index / 64] |= uint64_t{1} << (index % 64);
+	}
+
+	void Clear(const size_t index)
+	{
+		assert(index < size && "Bit is out of the plane's range");
+		words[index / 64] &= ~(uint64_t{1} << (index % 64));
+	}
+
+	void Assign(const size_t index, const bool value)
+	{
+		value ? Set(index) : Clear(index);
+	}
+
+	// The amount bits starting at index, as the low bits of the result. Reads at most two words, so it's how the
+	// board looks at the three cells of a row around a cell at once
+	[[nodiscard]] uint64_t GetBits(const size_t index, const size_t amount) const
+	{
+		assert(amount > 0 && amount < 64 && index + amount <= size && "Bits are out of the plane's range");
+
+		const size_t wordIndex = index / 64;
+		const size_t bitIndex = index % 64;
+
+		uint64_t bits = words[wordIndex] >> bitIndex;
+		if (bitIndex + amount > 64)
+		{
+			bits |= words[wordIndex + 1] << (64 - bitIndex);
+		}
+
+		return bits & ((uint64_t{1} << amount) - 1);
+	}
+
+	// The 64 bits starting at index, which can start before the plane or run past its end, where every bit reads as
+	// outsideBit. It's how the board looks at the neighbors of a whole word of cells at once, off the edges included
+	[[nodiscard]] uint64_t GetWordAt(const ptrdiff_t index, const bool outsideBit) const
+	{
+		const uint64_t outsideBits = outsideBit ? ~uint64_t{0} : 0;
+		const auto getWord = [outsideBits, this](const ptrdiff_t wordIndex)
+		{
+			if (wordIndex < 0 || wordIndex >= static_cast<ptrdiff_t>(this->words.size()))
+			{
+				return outsideBits;
+			}
+
+			const auto wordIndexUnsigned = static_cast<size_t>(wordIndex);
+			const size_t wordEnd = (wordIndexUnsigned + 1) * 64;
+			const uint64_t pastEndBits = wordEnd > this->size ? ~uint64_t{0} << (64 - (wordEnd - this->size)) : 0;
+			return this->words[wordIndexUnsigned] | (outsideBits & pastEndBits);
+		};
+
+		// Rounds down for negative indices too, so the bit index is always within a word
+		const ptrdiff_t wordIndex = index >= 0 ? index / 64 : -((63 - index) / 64);
+		const auto bitIndex = static_cast<size_t>(index - wordIndex * 64);
+
+		uint64_t bits = getWord(wordIndex) >> bitIndex;
+		if (bitIndex != 0)
+		{
+			bits |= getWord(wordIndex + 1) << (64 - bitIndex);
+		}
+
+		return bits;
+	}
+
+	// Calls callback(firstIndex, amount) for every run of set bits, in order. Runs go on from one word into the next,
+	// and whole words are skipped at once, so a mostly empty or mostly full plane only takes a step per word
+	template <typename Callback>
+	void ForEachRun(const Callback& callback) const
+	{
+		size_t runBegin = 0;
+		bool isInRun = false;
+
+		for (size_t wordIndex = 0; wordIndex < words.size(); ++wordIndex)
+		{
+			uint64_t bits = words[wordIndex];
+			size_t bitIndex = 0;
+
+			while (bitIndex < 64)
+			{
+				// Runs are found by counting the bits that stay the same, starting from the lowest one left
+				const auto sameBitsAmount = static_cast<size_t>(isInRun ? std::countr_one(bits) : std::countr_zero(bits));
+				if (bitIndex + sameBitsAmount >= 64)
+				{
+					break;
+				}
+
+				if (isInRun)
+				{
+					callback(runBegin, wordIndex * 64 + bitIndex + sameBitsAmount - runBegin);
+				}
+				else
+				{
+					runBegin = wordIndex * 64 + bitIndex + sameBitsAmount;
+				}
+
+				isInRun = !isInRun;
+				bitIndex += sameBitsAmount;
+				bits >>= sameBitsAmount;
+			}
+		}
+
+		if (isInRun)
+		{
+			callback(runBegin, size - runBegin);
+		}
+	}
+
+	void ClearAll()
+	{
+		std::ranges::fill(words, 0);
+	}
+
+	void SetAll()
+	{
+		std::ranges::fill(words, ~uint64_t{0});
+		if (size % 64 != 0)
+		{
+			words.back() = (uint64_t{1} << (size % 64)) - 1;
+		}
+	}
+
+	[[nodiscard]] uint64_t Count() const
+	{
+		uint64_t count = 0;
+		for (const uint64_t word : words)
+		{
+			count += static_cast<uint64_t>(std::popcount(word));
+		}
+
+		return count;
+	}
+
+	[[nodiscard]] size_t GetSize() const { return size; }
+	[[nodiscard]] std::span<uint64_t> GetWords() { return words; }
+	[[nodiscard]] std::span<const uint64_t> GetWords() const { return words; }
+
+private:
+	std::vector<uint64_t> words = {};
+	size_t size = 0;
+};
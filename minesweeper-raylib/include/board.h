@@ -1,13 +1,27 @@
 #pragma once
 
 #include "a_game_object.h"
+#include "bit_plane.h"
+#include "i_observers.h"
 #include "i_subjects.h"
+#include "index_set.h"
+#include "input_queue.h"
 
 #include "raylib_cpp.h"
+#include "resources_singleton.h"
 #include "vec2.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <string>
 #include <vector>
-#include <functional>
 
 // Rectangles correspond to sprites in cell_atlas.png
 namespace BoardSprite
@@ -33,75 +47,272 @@ namespace BoardSprite
 	constexpr Rectangle MINE{64, 96, 32, 32};
 	constexpr Rectangle EXPLODED_MINE{96, 96, 32, 32};
 	constexpr Rectangle FLAGGED_WRONG{0, 32, 32, 32};
+
+	// A cell's visual state packed into a small integer, which is what gets drawn and shared with bots.
+	// Closed cells combine the bits below, open cells are KEY_OPEN + the amount of adjacent mines.
+	// The highlighted and pressed bits are never stored, the board adds them while drawing.
+	constexpr uint8_t KEY_FLAGGED = 1 << 0;
+	constexpr uint8_t KEY_MINE = 1 << 1;
+	constexpr uint8_t KEY_EXPLODED = 1 << 2;
+	constexpr uint8_t KEY_HIGHLIGHTED = 1 << 3;
+	constexpr uint8_t KEY_PRESSED = 1 << 4; // Previewing a click or a chord
+	constexpr uint8_t KEY_OPEN = 1 << 5;
+	constexpr uint8_t KEY_COUNT = KEY_OPEN + 9;
+
+	enum Outcome : uint8_t
+	{
+		IN_PROGRESS,
+		WON,
+		LOST,
+		OUTCOME_COUNT
+	};
+
+	constexpr Rectangle SelectSprite(const uint8_t key, const Outcome outcome)
+	{
+		const bool isOpen = key >= KEY_OPEN;
+		const bool isFlagged = !isOpen && key & KEY_FLAGGED;
+		const bool hasMine = !isOpen && key & KEY_MINE;
+
+		if (outcome == WON && !isOpen && !isFlagged)
+		{
+			return FLAGGED;
+		}
+
+		if (outcome == LOST)
+		{
+			if (isFlagged && !hasMine)
+			{
+				return FLAGGED_WRONG;
+			}
+
+			if (hasMine)
+			{
+				return key & KEY_EXPLODED ? EXPLODED_MINE : MINE;
+			}
+		}
+
+		if (isOpen)
+		{
+			constexpr std::array<Rectangle, 9> OPEN_SPRITES{
+				OPEN_EMPTY, OPEN_1, OPEN_2, OPEN_3, OPEN_4, OPEN_5, OPEN_6, OPEN_7, OPEN_8
+			};
+
+			return OPEN_SPRITES[key - KEY_OPEN];
+		}
+
+		if (key & KEY_PRESSED)
+		{
+			return OPEN_EMPTY;
+		}
+
+		if (isFlagged)
+		{
+			return key & KEY_HIGHLIGHTED && outcome != WON ? FLAGGED_HIGHLIGHTED : FLAGGED;
+		}
+
+		if (key & KEY_HIGHLIGHTED && outcome != LOST)
+		{
+			return CLOSED_HIGHLIGHTED;
+		}
+
+		return CLOSED;
+	}
+
+	// Every possible cell sprite, evaluated at compile time, so drawing a cell is a single lookup
+	constexpr auto SPRITE_TABLE = []
+	{
+		std::array<std::array<Rectangle, KEY_COUNT>, OUTCOME_COUNT> table{};
+
+		for (uint8_t outcome = 0; outcome < OUTCOME_COUNT; ++outcome)
+		{
+			for (uint8_t key = 0; key < KEY_COUNT; ++key)
+			{
+				table[outcome][key] = SelectSprite(key, static_cast<Outcome>(outcome));
+			}
+		}
+
+		return table;
+	}();
 }
 
+// What it takes to draw the part of the board that fits into the window, without the board itself.
+// A simulation thread copies one of these out of the board after every step, so the window can draw it at any time
+struct BoardView
+{
+	static constexpr size_t NO_CELL = SIZE_MAX;
+
+	Vec2<int> screenPositionPixels = {};
+	int cellSizePixels = 0;
+	Vec2<int> visibleCells = {};
+	BoardSprite::Outcome outcome = BoardSprite::IN_PROGRESS;
+	std::vector<uint8_t> spriteKeys = {}; // Row by row, with the highlight and the click previews already applied
+	size_t hintedCell = NO_CELL;          // Index into spriteKeys, if the hinted cell is visible
+	bool isGameInProgress = false;
+
+	void Draw() const;
+};
+
+// Everything that changed on the board during one tick, so renderers, replays and solvers don't have to compare
+// every cell. Everything points into the board's own buffers, and stays valid until the board changes again
+struct BoardTickChanges
+{
+	enum Transition : uint8_t
+	{
+		GAME_STARTED,
+		GAME_WON,
+		GAME_LOST,
+		BOARD_CLEARED, // Every cell was closed and unflagged at once, without listing them
+		SNAPSHOT_LOADED,
+		TRANSITION_COUNT
+	};
+
+	const BitPlane* changedCells;               // Every cell whose open, flag, highlight or pressed state changed
+	std::span<const size_t> changedWordIndices; // The words of changedCells that have any of them set, once each
+	std::span<const Transition> transitions;    // In the order they last happened, each of them at most once
+
+	// Calls callback(cellIndex) for every changed cell, once each, and in index order within each word
+	template <typename Callback>
+	void ForEachChangedCell(const Callback& callback) const
+	{
+		const std::span<const uint64_t> words = changedCells->GetWords();
+		for (const size_t wordIndex : changedWordIndices)
+		{
+			for (uint64_t bits = words[wordIndex]; bits != 0; bits &= bits - 1)
+			{
+				callback(wordIndex * 64 + static_cast<size_t>(std::countr_zero(bits)));
+			}
+		}
+	}
+
+	[[nodiscard]] size_t GetChangedCellsAmount() const
+	{
+		const std::span<const uint64_t> words = changedCells->GetWords();
+		size_t amount = 0;
+		for (const size_t wordIndex : changedWordIndices)
+		{
+			amount += static_cast<size_t>(std::popcount(words[wordIndex]));
+		}
+
+		return amount;
+	}
+};
+
+// A move on a cell given by its position, for boards that are played without a mouse
+struct BoardMove
+{
+	enum Type : uint8_t
+	{
+		OPEN,
+		FLAG,
+		CHORD
+	};
+
+	Type type;
+	size_t x;
+	size_t y;
+};
+
+class SharedBoard;
+
 class Board final : AGameObject,
-                    ISubjectGameStart, ISubjectFlagCell, ISubjectBoardMouseButtonDown, ISubjectGameWin, ISubjectGameLose
+                    ISubjectGameStart, ISubjectFlagCell, ISubjectBoardMouseButtonDown, ISubjectGameWin, ISubjectGameLose,
+                    ISubjectCellChange
 {
 private:
-	class Cell
-	{
-	public:
-		explicit Cell(const Vec2<int>&& pos);
-		~Cell() = default;
-		Cell(Cell&) = delete;
-		Cell& operator=(Cell&) = delete;
-		Cell(Cell&&) = default;
-		Cell& operator=(Cell&&) = default;
-
-		[[nodiscard]] bool IsOpen() const { return isOpen; }
-		[[nodiscard]] bool HasMine() const { return hasMine; }
-		[[nodiscard]] bool HasExplodedMine() const { return hasExplodedMine; }
-		[[nodiscard]] bool IsHighlighted() const { return isHighlighted; }
-		[[nodiscard]] bool IsFlagged() const { return isFlagged; }
-		[[nodiscard]] Vec2<int> GetCellPosition() const { return cellPosition; }
-		[[nodiscard]] uint8_t GetAdjacentMinesAmount() const { return minesAdjacent; }
-		[[nodiscard]] bool IsPreviewingClick() const { return isPreviewingClick; }
-
-		void Initialize(const bool& placeMine, const uint8_t& adjacentMines, const std::vector<Cell*>& neighborCells);
-		void Highlight(const bool& isActive);
-		[[nodiscard]] bool ToggleFlag();
-		void SetPreviewingChord(const bool& previewChord) { isPreviewingChord = previewChord; }
-		void SetPreviewingClick(const bool& previewClick) { isPreviewingClick = previewClick; }
-		int Reveal();
-		void ExplodeMine() { hasExplodedMine = true; }
-
-		void Draw(const Vec2<int>& boardOriginPixels,
-		          const int& cellSizePixels,
-		          const bool& isGameWon,
-		          const bool& isGameLost) const;
-		void Reset();
-
-	private:
-		bool isOpen = false;
-		bool hasMine = false;
-		bool hasExplodedMine = false;
-		bool isHighlighted = false;
-		bool isFlagged = false;
-		bool isPreviewingChord = false;
-		bool isPreviewingClick = false;
-
-		Vec2<int> cellPosition = {};
-		uint8_t minesAdjacent = 0;
-		std::vector<Cell*> adjacentCells = {};
-
-		[[nodiscard]] Rectangle GetCellSprite(const bool& isGameWon, const bool& isGameLost) const;
-	};
+	static constexpr size_t NO_CELL = SIZE_MAX;
 
-	typedef std::function<void (Cell& currentCell, Cell& adjacentCell)> CallbackOnAdjacentCells;
+	// Fixed capacity list of cells around a cell, so that filling it never allocates memory
+	struct AdjacentCells
+	{
+		std::array<size_t, 8> cellIndices = {};
+		uint8_t amount = 0;
+
+		void Add(const size_t cellIndex) { cellIndices[amount++] = cellIndex; }
+		void Clear() { amount = 0; }
+		[[nodiscard]] bool Contains(const size_t cellIndex) const { return std::find(begin(), end(), cellIndex) != end(); }
+		[[nodiscard]] const size_t* begin() const { return cellIndices.data(); }
+		[[nodiscard]] const size_t* end() const { return cellIndices.data() + amount; }
+	};
 
 public:
-	Board(Vec2<int> screenPos, int cellSize, int boardWidthCells, int boardHeightCells, int maxMinesAmount);
+	Board(Vec2<int> screenPos, int cellSize, size_t boardWidthCells, size_t boardHeightCells, uint64_t maxMinesAmount, bool autoChord);
 	~Board() override;
 
+	// How much memory a board of this size allocates, which is all it ever allocates while it's played
+	[[nodiscard]] static uint64_t GetMemoryFootprint(const size_t& boardWidthCells, const size_t& boardHeightCells);
+
 	void Update() override;
 	void Draw() const override;
 	void Reset() override;
+	using AGameObject::SetLayout;
+
+	// Update gets the mouse states from the input queue. A board that doesn't run on the window's thread is
+	// handed them instead, along with the screen size, the cursor has to be on the screen for all of them
+	void ProcessMouseStates(std::span<const MouseState> mouseStates, const Vec2<int>& screenSizePixels);
+	void CopyView(BoardView& view, const Vec2<int>& screenSizePixels) const;
+	void ReserveView(BoardView& view) const; // For as many cells as can ever be visible, so copying never allocates
 
 	void Attach(IObserver* observer) override;
 	void Detach(IObserver* observer) override;
 	void NotifyFlagToggleObservers() override; // We need to call this in the Game class constructor and when resetting the game
 
+	// Ends the tick's change set, then notifies the observers of everything the board did during the tick.
+	// Whatever runs the board calls this once per frame, after everything that could change cells
+	void EndTick();
+	[[nodiscard]] BoardTickChanges GetTickChanges() const { return {&tickChangedCells, tickChangedWords, tickTransitions}; }
+
+	[[nodiscard]] bool IsGameInProgress() const { return boardState == IN_PROGRESS; }
+	[[nodiscard]] BoardSprite::Outcome GetOutcome() const;
+
+	// Plays a move the same way clicking on the cell would, so the first cell opened starts the game.
+	// Returns false if the cell isn't on the board or the game is already over
+	bool PlayMove(const BoardMove& move);
+	void SetSeed(uint32_t newSeed); // Every layout after this is generated from the seed, instead of from the clock
+
+	// Puts the board's open, flag and number planes into a shared memory segment with the given name, and plays the
+	// moves that bots put into its move ring, see SharedBoardHeader. The planes are updated when the tick ends.
+	// Update plays the moves, a board that doesn't run on the window's thread is told to play them instead.
+	// Returns false if the segment couldn't be made
+	[[nodiscard]] bool ShareState(const std::string& name);
+	[[nodiscard]] bool IsStateShared() const { return sharedBoard != nullptr; }
+	void PlaySharedMoves();
+
+	[[nodiscard]] size_t GetWidth() const { return width; }
+	[[nodiscard]] size_t GetHeight() const { return height; }
+	[[nodiscard]] uint64_t GetMaxMines() const { return maxMinesOnBoard; }
+	[[nodiscard]] int64_t GetMinesLeftToFlag() const { return cellsLeftToFlag; }
+	[[nodiscard]] uint8_t GetCellSpriteKey(const size_t& cellIndex) const { return GetSpriteKey(cellIndex, 0); }
+
+	// Snapshots store the mine, open and flag states as bitplanes, along with the seed, the flag count
+	// and the elapsed time, followed by a checksum. Only games in progress can be saved.
+	// Both return false if the file couldn't be written or read, or doesn't match this board.
+	[[nodiscard]] bool SaveSnapshot(const std::string& filePath, double timeElapsed) const;
+	[[nodiscard]] bool LoadSnapshot(const std::string& filePath, double& timeElapsed);
+
+	// Undoing and redoing only works while the game is in progress
+	void Undo();
+	void Redo();
+
+	// Call callback(cellIndex) for every cell on the frontier, in index order. The closed frontier is every closed,
+	// unflagged cell next to an open numbered cell, and the open frontier is every open numbered cell next to a closed,
+	// unflagged cell. Both are kept up to date as cells change, in a plane of their own, so walking them only looks
+	// at a word for every 64 cells, and at the cells that are on the frontier
+	template <typename Callback>
+	void ForEachClosedFrontierCell(const Callback& callback) const;
+	template <typename Callback>
+	void ForEachOpenFrontierCell(const Callback& callback) const;
+
+	// Flags a cell that must be a mine, or outlines a cell that must be safe, going by a single numbered cell and
+	// the numbers next to its closed cells. The player's flags are never taken for mines, since they could be wrong.
+	// Only the numbered cells whose surroundings changed since the last hint are checked.
+	// Returns false if there is nothing that can be deduced that way.
+	bool ShowHint();
+
+	// When the oldest mouse event that changed cells since the last call arrived, or NO_INPUT_TIME if none did.
+	// The game takes it once the frame with those changes is on the screen, to measure the input latency
+	static constexpr double NO_INPUT_TIME = -1;
+	[[nodiscard]] double TakeChangingInputTime();
+
 private:
 	enum BoardState
 	{
@@ -111,15 +322,150 @@ private:
 		GAME_WON
 	};
 
+	// Buffers that grow with the board are at most this large, and never grow during a game
+	static constexpr size_t BUFFER_CAPACITY = 1 << 16;
+
+	// The cells that didn't fit in a buffer are found again in the tick's changes, see ForEachTickChangedCellFrom
+	static constexpr size_t NO_REFILL = SIZE_MAX;
+
+	// The cell changes that wait for the observers never grow past this, see RecordCellChange
+	static constexpr size_t CELL_CHANGES_CAPACITY = 4096;
+
+	// The hovered cell, and the chorded cells around it
+	static constexpr size_t MAX_OVERLAID_CELLS = 9;
+
 	BoardState boardState = LAYOUT_UNINITIALIZED;
-	std::vector<Cell> cells = {};
-	std::vector<Cell*> previewChordedCells = {};
-	Cell* mouseSelectedCell = nullptr;
-	const int width;
-	const int height;
-	const int maxMinesOnBoard;
-	int cellsLeftToReveal;
-	int cellsLeftToFlag;
+	const size_t width;
+	const size_t height;
+	const size_t cellsAmount;
+	const uint64_t maxMinesOnBoard;
+
+	// A cell's state is a bit in each of these planes, so it takes half a byte, and its number is counted from the
+	// mine plane whenever it's needed instead of being stored. Open cells never have a mine or a flag, so on open
+	// cells the flag plane marks the constraints the hint solver still has to check instead. The frontier plane
+	// marks the closed frontier on closed cells and the open frontier on open cells.
+	// The mouse highlight and the click previews only ever apply to a few cells at a time, so the board draws those
+	// on top instead of storing them in every cell
+	BitPlane minePlane;
+	BitPlane openPlane;
+	BitPlane flagPlane;
+	BitPlane frontierPlane;
+	size_t explodedCellIndex = NO_CELL; // The mine that lost the game
+	size_t mouseSelectedCell = NO_CELL;
+
+	// The buffers that only hold what a single game needs (the reveal stack, the undo history and the cell changes)
+	// come from this arena. Its memory is allocated along with the board, sized for what they reserve up front, none
+	// of them grow past that, and a reset takes all of it back at once
+	std::unique_ptr<std::byte[]> sessionArenaBuffer;
+	std::pmr::monotonic_buffer_resource sessionArena;
+
+	std::pmr::vector<size_t> revealStack{&sessionArena};
+	size_t revealStackRefillPosition = NO_REFILL; // See RevealCells
+	uint64_t cellsLeftToReveal;
+	int64_t cellsLeftToFlag;
+	uint32_t seed = 0; // The seed the current mine layout was generated with
+	bool isSeedFixed = false;
+
+	// What is drawn over the cells this frame
+	size_t highlightedCell = NO_CELL;
+	size_t clickPreviewCell = NO_CELL;
+	AdjacentCells previewChordedCells = {};
+
+	// Undo history. An action only stores the runs of cells it changed in each row, in one shared buffer,
+	// so a reveal takes a run for every row span it opened, and undoing or redoing it takes time proportional
+	// to the amount of cells it changed. The buffer never grows, the oldest actions are forgotten to make room
+	enum ActionType : uint8_t
+	{
+		OPEN_CELLS,
+		TOGGLE_FLAG
+	};
+
+	struct Action
+	{
+		ActionType type;
+		size_t changesEnd; // The changes of an action are between the end of the previous action and this
+	};
+
+	struct ActionRun
+	{
+		uint32_t row;
+		uint32_t firstX;
+		uint32_t cellsAmount;
+	};
+
+	// No open cell before this one has a dirty constraint, so the hint solver starts looking from here
+	size_t firstDirtyConstraint = 0;
+
+	// The rectangle around every cell that was opened or closed since the last hint, empty when first is past last.
+	// The constraints up to three cells away from them are only marked as dirty once a hint is asked for
+	struct CellArea
+	{
+		size_t firstX = SIZE_MAX;
+		size_t firstY = SIZE_MAX;
+		size_t lastX = 0;
+		size_t lastY = 0;
+	};
+	CellArea openChangedArea = {};
+
+	static constexpr size_t NO_HINT = NO_CELL;
+	size_t hintedCellIndex = NO_HINT;
+
+	// When auto chording, every cell that was opened during an action gets chorded automatically if it can be,
+	// which in turn opens more cells that might be chordable. Flagging a cell never chords anything
+	const bool isAutoChordEnabled;
+	IndexSet autoChordCandidates{&sessionArena};
+	size_t autoChordRefillPosition = NO_REFILL; // See AutoChord
+
+	std::pmr::vector<Action> actionHistory{&sessionArena};
+	std::pmr::vector<ActionRun> actionChanges{&sessionArena};
+	size_t actionsApplied = 0; // Actions after this have been undone and can be redone
+	bool isRecordingAction = false;
+
+	// The observers are only notified once the tick ends, so they never run while the board is in the middle of
+	// changing cells. Until then, the notifications wait in a queue of small events, where every type of event
+	// is only queued once, however many times it happens during the tick, see QueueEvent.
+	// The cell change observers are the exception, see RecordCellChange
+	struct Event
+	{
+		enum Type : uint8_t
+		{
+			GAME_STARTED,
+			FLAG_COUNT_CHANGED,
+			MOUSE_BUTTON_DOWN,
+			GAME_WON,
+			GAME_LOST,
+			TYPE_COUNT
+		};
+
+		Type type;
+		int64_t minesLeftToFlag = 0; // Only for FLAG_COUNT_CHANGED
+	};
+
+	std::vector<Event> events = {};
+	std::vector<Event> dispatchedEvents = {}; // An observer can make the board queue events while they're dispatched
+	std::pmr::vector<CellChange> cellChanges{&sessionArena}; // Changes that haven't been sent to the observers yet
+	double changingInputTime = NO_INPUT_TIME;
+
+	// The last tick's change set, as a bit for every cell and the indices of the words that have any bits set, so it
+	// never takes more than an eighth of a byte and a word index for every 64 cells, and every cell is in it once.
+	// Cells are added as they change, and the set is only cleared once the board changes again after the tick ended
+	BitPlane tickChangedCells;
+	std::vector<size_t> tickChangedWords = {};
+	bool isTickChangeSetEnded = false;
+	std::vector<BoardTickChanges::Transition> transitions = {}; // Since the last tick ended
+	std::vector<BoardTickChanges::Transition> tickTransitions = {};
+
+	// The cells whose sprites the overlays changed when the last tick ended, along with those sprites
+	struct OverlaidCell
+	{
+		size_t cellIndex;
+		uint8_t spriteKey;
+	};
+
+	std::array<OverlaidCell, MAX_OVERLAID_CELLS> overlaidCells = {};
+	uint8_t overlaidCellsAmount = 0;
+
+	std::unique_ptr<SharedBoard> sharedBoard; // Only exists while the board's state is shared
 
 	std::list<IObserver*> observers = {};
 
@@ -127,21 +473,257 @@ private:
 	void NotifyBoardMouseButtonDownObservers() override;
 	void NotifyGameWonObservers() override;
 	void NotifyGameLostObservers() override;
+	void NotifyBoardClearedObservers() override;
+	void NotifyCellChangeObservers() override;
+	void QueueEvent(const Event& event);
+	void DispatchEvents();
+
+	template <typename TObserver, typename TCallback>
+	void NotifyObservers(const TCallback& callback)
+	{
+		for (IObserver* observer : observers)
+		{
+			if (auto* specificObserver = dynamic_cast<TObserver*>(observer); specificObserver != nullptr)
+			{
+				callback(*specificObserver);
+			}
+		}
+	}
+
+	// A cell's state, put together from the planes
+	[[nodiscard]] bool IsOpen(const size_t& cellIndex) const { return openPlane.Test(cellIndex); }
+	[[nodiscard]] bool HasMine(const size_t& cellIndex) const { return minePlane.Test(cellIndex); }
+	[[nodiscard]] bool IsFlagged(const size_t& cellIndex) const { return !IsOpen(cellIndex) && flagPlane.Test(cellIndex); }
+	[[nodiscard]] bool IsUnknown(const size_t& cellIndex) const { return !IsOpen(cellIndex) && !flagPlane.Test(cellIndex); }
+	[[nodiscard]] bool CanOpen(const size_t& cellIndex) const { return IsUnknown(cellIndex) && !HasMine(cellIndex); }
+	[[nodiscard]] bool IsOpenNumbered(const size_t& cellIndex) const { return IsOpen(cellIndex) && CountAdjacentMines(cellIndex) > 0; }
+	[[nodiscard]] uint8_t GetAdjacentMinesAmount(const size_t& cellIndex) const { return IsOpen(cellIndex) ? CountAdjacentMines(cellIndex) : 0; }
+	[[nodiscard]] uint8_t GetSpriteKey(const size_t& cellIndex, const uint8_t& overlayKey) const;
+	[[nodiscard]] uint8_t CountAdjacentMines(const size_t& cellIndex) const;
+	[[nodiscard]] bool HasUnknownNeighbor(const size_t& cellIndex) const;
+	[[nodiscard]] bool HasOpenNumberedNeighbor(const size_t& cellIndex) const;
+	void DrawCell(const size_t& cellIndex,
+	              const ResourcesSingleton::ScaledAtlases& atlases,
+	              const BoardSprite::Outcome& outcome,
+	              const uint8_t& overlayKey) const;
 
-	void ResetCellsSpriteState() const;
-	void ProcessInput();
+	// Calls countBits(firstCellIndex, cellsAmount) for the cells of each row around the given cell, which returns
+	// them as bits, and adds up the bits of every cell around it
+	template <typename CountBits>
+	[[nodiscard]] uint8_t CountAdjacentCells(const size_t& cellIndex, const CountBits& countBits) const;
+
+	void ClearCellOverlays();
+	void ProcessInput(const MouseState& mouseState);
+	void OpenSelectedCell();
+	void ChordSelectedCell();
 	[[nodiscard]] Vec2<int> GetCellPositionUnderMouse(const Vec2<int>& mousePosPixels) const;
-	void OpenClickedCell(Cell& currentCell);
+	void OpenClickedCell(const size_t& cellIndex);
+	[[nodiscard]] bool OpenCell(const size_t& cellIndex); // Returns false if the cell can't be opened
+	[[nodiscard]] uint64_t RevealCells(const size_t& startCellIndex);
 	void ChordClickedCell(const bool& openCells);
+	void FlagCell(const size_t& cellIndex);
+	void ToggleCellFlag(const size_t& cellIndex);
+	void AutoChord();
 
 	void GenerateBoardLayout();
-	void DetermineInitialFreeCellPositions(std::vector<Vec2<int>>& freeCellPositions);
-	void PlaceMines(std::vector<Vec2<int>>& freeCellPositions);
-	void InitializeNonMinedCells();
+	void PlaceMines();
+	[[nodiscard]] bool IsProvenMine(const size_t& cellIndex) const;
+
+	// Calls callback(adjacentCellIndex) for every cell around the given cell.
+	// This is a template instead of taking a std::function, so that the callbacks never allocate memory
+	template <typename Callback>
+	void ProcessCellNeighbors(const size_t& cellIndex, const Callback& callback) const;
+
+	[[nodiscard]] Vec2<int> GetVisibleCellsAmount() const;
+	[[nodiscard]] Vec2<int> GetVisibleCellsAmount(const Vec2<int>& screenSizePixels) const;
+	[[nodiscard]] bool IsCellVisible(const size_t& cellIndex) const;
+	[[nodiscard]] Vec2<int> GetCellScreenPosition(const size_t& cellIndex) const; // Only valid for visible cells
+	[[nodiscard]] uint8_t GetOverlayKey(const size_t& cellIndex) const;
+
+	void RecordCellChange(const size_t& cellIndex, const CellChange::Type& type);
+	void RecordCellRun(const size_t& firstCellIndex, const size_t& cellsAmount, const CellChange::Type& type);
+	void RecordWholeBoardChange();
+	void MarkTickChangedCell(const size_t& cellIndex);
+	void ClearTickChanges();
+	template <typename Callback>
+	[[nodiscard]] size_t ForEachTickChangedCellFrom(const size_t& firstWordPosition, const Callback& callback) const;
+	void RecordTransition(const BoardTickChanges::Transition& transition);
+	void GatherOverlayChanges();
+	void PublishSharedState(const bool& isWholeBoardChanged);
+	void UpdateFrontier(const size_t& changedCellIndex, const bool& wasOpen);
+	void UpdateFrontierMembership(const size_t& cellIndex);
+	void MarkConstraintsDirty();
+	void RebuildFrontier();
+	[[nodiscard]] uint64_t GetEnclosedCells(const size_t& wordIndex) const;
+	void ReserveSessionBuffers();
+	[[nodiscard]] static size_t GetSessionArenaSize(const size_t& cellsAmount);
+	[[nodiscard]] static size_t GetActionHistoryCapacity(const size_t& cellsAmount);
+
+	void BeginAction();
+	void RecordActionChange(const size_t& cellIndex);
+	void EndAction(const ActionType& type);
+	void TrimActionHistory();
+	void ClearActionHistory();
+	[[nodiscard]] size_t GetActionChangesBegin(const size_t& actionIndex) const;
 
-	void ProcessCellNeighbors(Cell& cellToProcess, const CallbackOnAdjacentCells& callback);
 	void WinGame();
 	void LoseGame();
 	[[nodiscard]] bool IsGameWon() const { return boardState == GAME_WON; }
 	[[nodiscard]] bool IsGameLost() const { return boardState == GAME_LOST; }
 };
+
+// The frontier plane means something different on open and closed cells, so it's walked a word at a time,
+// together with the open plane
+template <typename Callback>
+void Board::ForEachClosedFrontierCell(const Callback& callback) const
+{
+	const std::span<const uint64_t> frontierWords = frontierPlane.GetWords();
+	const std::span<const uint64_t> openWords = openPlane.GetWords();
+
+	for (size_t wordIndex = 0; wordIndex < frontierWords.size(); ++wordIndex)
+	{
+		for (uint64_t bits = frontierWords[wordIndex] & ~openWords[wordIndex]; bits != 0; bits &= bits - 1)
+		{
+			callback(wordIndex * 64 + static_cast<size_t>(std::countr_zero(bits)));
+		}
+	}
+}
+
+template <typename Callback>
+void Board::ForEachOpenFrontierCell(const Callback& callback) const
+{
+	const std::span<const uint64_t> frontierWords = frontierPlane.GetWords();
+	const std::span<const uint64_t> openWords = openPlane.GetWords();
+
+	for (size_t wordIndex = 0; wordIndex < frontierWords.size(); ++wordIndex)
+	{
+		for (uint64_t bits = frontierWords[wordIndex] & openWords[wordIndex]; bits != 0; bits &= bits - 1)
+		{
+			callback(wordIndex * 64 + static_cast<size_t>(std::countr_zero(bits)));
+		}
+	}
+}
+
+// Starts from the given position in the list of the tick's changed words, and stops as soon as the callback returns
+// false. Returns the position of the word it stopped in, so the next call can carry on from there, or NO_REFILL if
+// it got through all of them
+template <typename Callback>
+size_t Board::ForEachTickChangedCellFrom(const size_t& firstWordPosition, const Callback& callback) const
+{
+	const std::span<const uint64_t> changedWords = tickChangedCells.GetWords();
+
+	for (size_t position = firstWordPosition; position < tickChangedWords.size(); ++position)
+	{
+		const size_t wordIndex = tickChangedWords[position];
+		for (uint64_t bits = changedWords[wordIndex]; bits != 0; bits &= bits - 1)
+		{
+			if (!callback(wordIndex * 64 + static_cast<size_t>(std::countr_zero(bits))))
+			{
+				return position;
+			}
+		}
+	}
+
+	return NO_REFILL;
+}
+
+// The three cells of a row are read together, the cell itself is masked out of its own row
+template <typename CountBits>
+uint8_t Board::CountAdjacentCells(const size_t& cellIndex, const CountBits& countBits) const
+{
+	const size_t x = cellIndex % width;
+	const size_t firstX = x > 0 ? x - 1 : 0;
+	const size_t columnsAmount = std::min(x + 2, width) - firstX;
+	const size_t rowFirstCell = cellIndex - x + firstX;
+
+	const uint64_t ownRowBits = countBits(rowFirstCell, columnsAmount) & ~(uint64_t{1} << (x - firstX));
+	int count = std::popcount(ownRowBits);
+
+	if (cellIndex >= width)
+	{
+		count += std::popcount(countBits(rowFirstCell - width, columnsAmount));
+	}
+
+	if (cellIndex + width < cellsAmount)
+	{
+		count += std::popcount(countBits(rowFirstCell + width, columnsAmount));
+	}
+
+	return static_cast<uint8_t>(count);
+}
+
+// Defined in the header, since the board code is split over several source files that all visit neighbors
+template <typename Callback>
+void Board::ProcessCellNeighbors(const size_t& cellIndex, const Callback& callback) const
+{
+	// Only the column is needed, the rows above and below can be checked from the index alone
+	const size_t x = cellIndex % width;
+	const bool hasLeft = x > 0;
+	const bool hasRight = x + 1 < width;
+	const bool hasAbove = cellIndex >= width;
+	const bool hasBelow = cellIndex + width < cellsAmount;
+
+	//[o] []  []
+	//[]  x   []
+	//[]  []  []
+	if (hasLeft && hasAbove)
+	{
+		callback(cellIndex - width - 1);
+	}
+
+	//[]  [o] []
+	//[]  x   []
+	//[]  []  []
+	if (hasAbove)
+	{
+		callback(cellIndex - width);
+	}
+
+	//[]  []  [o]
+	//[]  x   []
+	//[]  []  []
+	if (hasRight && hasAbove)
+	{
+		callback(cellIndex - width + 1);
+	}
+
+	//[]  []  []
+	//[o] x   []
+	//[]  []  []
+	if (hasLeft)
+	{
+		callback(cellIndex - 1);
+	}
+
+	//[]  []  []
+	//[]  x   [o]
+	//[]  []  []
+	if (hasRight)
+	{
+		callback(cellIndex + 1);
+	}
+
+	//[]  []  []
+	//[]  x   []
+	//[o] []  []
+	if (hasLeft && hasBelow)
+	{
+		callback(cellIndex + width - 1);
+	}
+
+	//[]  []  []
+	//[]  x   []
+	//[]  [o] []
+	if (hasBelow)
+	{
+		callback(cellIndex + width);
+	}
+
+	//[]  []  []
+	//[]  x   []
+	//[]  []  [o]
+	if (hasRight && hasBelow)
+	{
+		callback(cellIndex + width + 1);
+	}
+}
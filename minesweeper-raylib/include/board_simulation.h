@@ -0,0 +1,183 @@
+#pragma once
+
+#include "board.h"
+#include "i_observers.h"
+#include "i_subjects.h"
+#include "input_queue.h"
+#include "triple_buffer.h"
+
+#include "vec2.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Runs a board, either right on the window's thread or on a simulation thread of its own.
+// On its own thread, a long reveal or hint search never holds up drawing, and drawing never holds up the input.
+// The window's thread sends the board its input and commands, and the board sends back its notifications,
+// both in batches that only take a lock for as long as it takes to swap two buffers. The board is drawn from the
+// newest BoardView it has published through a triple buffer, so drawing never waits for the board either.
+// The observers attached here are always notified on the window's thread.
+// It's off by default: a step on a standard board takes microseconds, but its notifications and view are only
+// taken in the frame after the one that sent its commands, so clicks show up a frame later than without the thread.
+// It only pays off on huge boards, where a single click can keep the board busy for longer than a frame.
+class BoardSimulation final : ISubject,
+                              public IObserverGameStart, public IObserverFlagToggle, public IObserverBoardMouseButtonDown,
+                              public IObserverGameWon, public IObserverGameLost, public IObserverCellChange
+{
+public:
+	BoardSimulation(Vec2<int> screenPos,
+	                int cellSize,
+	                size_t boardWidthCells,
+	                size_t boardHeightCells,
+	                uint64_t maxMinesAmount,
+	                bool autoChord,
+	                bool threaded,
+	                const std::string& sharedBoardName); // See Board::ShareState, the board isn't shared if it's empty
+	~BoardSimulation() override;
+	BoardSimulation(const BoardSimulation&) = delete;
+	BoardSimulation& operator=(const BoardSimulation&) = delete;
+	BoardSimulation(BoardSimulation&&) = delete;
+	BoardSimulation& operator=(BoardSimulation&&) = delete;
+
+	void Attach(IObserver* observer) override;
+	void Detach(IObserver* observer) override;
+
+	// The same as on Board, except that on a simulation thread they only take effect once the board gets to them
+	void Update();
+	void Draw() const;
+	void Reset();
+	void SetLayout(const Vec2<int>& screenPos, const int& cellSize);
+	void NotifyFlagToggleObservers();
+	void Undo();
+	void Redo();
+	void ShowHint();
+	void SaveSnapshot(double timeElapsed);
+	void LoadSnapshot(); // Notifies the snapshot load observers if the snapshot was loaded
+
+	// Notifies the observers of everything the board has done since the last call, the game calls this once per frame
+	void DispatchNotifications();
+
+	[[nodiscard]] bool IsGameInProgress() const;
+	[[nodiscard]] double TakeChangingInputTime(); // See Board::TakeChangingInputTime
+
+private:
+	struct Command
+	{
+		enum Type : uint8_t
+		{
+			MOUSE_STATE,
+			SET_LAYOUT,
+			SET_SCREEN_SIZE,
+			RESET,
+			NOTIFY_FLAG_COUNT,
+			UNDO,
+			REDO,
+			SHOW_HINT,
+			SAVE_SNAPSHOT,
+			LOAD_SNAPSHOT,
+			PLAY_SHARED_MOVES
+		};
+
+		Type type;
+		MouseState mouseState = {};
+		Vec2<int> position = {}; // The screen position for SET_LAYOUT, the screen size for SET_SCREEN_SIZE
+		int cellSize = 0;
+		double timeElapsed = 0;
+	};
+
+	struct Notification
+	{
+		enum Type : uint8_t
+		{
+			GAME_STARTED,
+			FLAG_TOGGLED,
+			MOUSE_BUTTON_DOWN,
+			GAME_WON,
+			GAME_LOST,
+			CELLS_CHANGED,
+			BOARD_CLEARED,
+			SNAPSHOT_LOADED,
+			INPUT_CHANGED_CELLS
+		};
+
+		Type type;
+		int64_t amount = 0; // Mines left to flag for FLAG_TOGGLED, the amount of cell changes for CELLS_CHANGED
+		double time = 0;    // The elapsed time for SNAPSHOT_LOADED, the input time for INPUT_CHANGED_CELLS
+	};
+
+	// The batches never grow past these, see AddToBatch and SendStepBatches
+	static constexpr size_t COMMAND_BATCH_CAPACITY = 1024;
+	static constexpr size_t NOTIFICATION_BATCH_CAPACITY = 1024;
+	static constexpr size_t CELL_CHANGE_BATCH_CAPACITY = 4096;
+
+	Board board;
+	const bool isThreaded;
+	bool isStateShared = false;
+	std::list<IObserver*> observers = {};
+
+	// Only touched by the window's thread
+	std::vector<Command> outgoingCommands = {};
+	std::vector<Notification> receivedNotifications = {};
+	std::vector<CellChange> receivedCellChanges = {};
+	const BoardView* latestView = nullptr;
+	Vec2<int> sentScreenSize = {};
+	double changingInputTime = Board::NO_INPUT_TIME;
+
+	// Shared between the threads, guarded by batchMutex
+	std::mutex batchMutex;
+	std::condition_variable commandsSent;
+	std::condition_variable notificationsTaken;
+	std::vector<Command> pendingCommands = {};
+	std::vector<Notification> pendingNotifications = {};
+	std::vector<CellChange> pendingCellChanges = {};
+	bool isStopRequested = false;
+
+	// Only touched by the simulation thread
+	std::vector<Command> stepCommands = {};
+	std::vector<MouseState> stepMouseStates = {};
+	std::vector<Notification> stepNotifications = {};
+	std::vector<CellChange> stepCellChanges = {};
+	Vec2<int> screenSize = {};
+
+	TripleBuffer<BoardView> views;
+	std::thread simulationThread;
+
+	void SendCommand(const Command& command);
+	static void AddToBatch(std::vector<Command>& batch, const Command& command);
+	[[nodiscard]] static bool IsMouseMove(const Command& command);
+	void Execute(const Command& command);
+	void RunSimulation();
+	void Step();
+	void ProcessStepMouseStates();
+	void SendStepBatches();
+	void PushNotification(const Notification& notification);
+
+	void NotifySnapshotLoadObservers(const double& timeElapsed);
+
+	template <typename TObserver, typename TCallback>
+	void NotifyObservers(const TCallback& callback)
+	{
+		for (IObserver* observer : observers)
+		{
+			if (auto* specificObserver = dynamic_cast<TObserver*>(observer); specificObserver != nullptr)
+			{
+				callback(*specificObserver);
+			}
+		}
+	}
+
+	// The board's own notifications, which arrive on the simulation thread and get queued for the window's thread
+	void OnGameStarted() override;
+	void OnToggledCellFlag(const int64_t& minesLeftToFlag) override;
+	void OnBoardMouseButtonDown() override;
+	void OnGameWon() override;
+	void OnGameLost() override;
+	void OnCellsChanged(std::span<const CellChange> changes) override;
+	void OnBoardCleared() override;
+};
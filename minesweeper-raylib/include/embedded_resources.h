@@ -0,0 +1,7835 @@
+#pragma once
+
+// Generated by tools/embed_resources.py from the images in resources/, do not edit by hand.
+// The pixels are already decoded to 8-bit RGBA, so they can be uploaded to the GPU without any file I/O.
+
+namespace EmbeddedResources
+{
+	constexpr int CELL_ATLAS_WIDTH = 128;
+	constexpr int CELL_ATLAS_HEIGHT = 128;
+	inline constexpr unsigned char CELL_ATLAS_PIXELS[] = {
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,32,32,32,255,
+		32,32,32,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,32,32,32,255,
+		32,32,32,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,32,32,32,255,
+		32,32,32,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,32,32,32,255,
+		32,32,32,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,32,32,32,255,
+		32,32,32,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,32,32,32,255,
+		32,32,32,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,
+		32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,32,32,32,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,80,80,80,255,
+		80,80,80,255,80,80,80,255,80,80,80,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,255,255,255,255,
+		0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,
+		0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,
+		191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,0,0,255,
+		191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,0,0,255,191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,0,128,0,255,
+		0,128,0,255,0,128,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,0,0,255,191,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,0,0,255,191,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		0,0,128,255,0,0,128,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,0,0,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,0,128,128,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,128,0,0,255,
+		128,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,
+		0,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,
+		0,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,
+		0,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,0,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,
+		0,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,26,26,26,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,
+		0,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,0,0,0,255,
+		0,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,
+		255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,255,0,0,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+	};
+
+	constexpr int DIGITS_ATLAS_WIDTH = 384;
+	constexpr int DIGITS_ATLAS_HEIGHT = 64;
+	inline constexpr unsigned char DIGITS_ATLAS_PIXELS[] = {
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,225,0,0,255,
+		225,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,82,0,0,255,0,0,0,255,0,0,0,255,82,0,0,255,
+		82,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+	};
+
+	constexpr int FACE_ATLAS_WIDTH = 320;
+	constexpr int FACE_ATLAS_HEIGHT = 64;
+	inline constexpr unsigned char FACE_ATLAS_PIXELS[] = {
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,247,239,53,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,247,239,53,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,247,239,53,255,251,242,54,255,
+		247,239,53,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,247,239,53,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		247,239,53,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,
+		251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,
+		251,242,54,255,251,242,54,255,251,242,54,255,251,242,54,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,191,191,191,255,
+		191,191,191,255,191,191,191,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		255,255,255,255,255,255,255,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+		127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,127,127,127,255,
+	};
+
+	constexpr int ICON_WIDTH = 32;
+	constexpr int ICON_HEIGHT = 32;
+	inline constexpr unsigned char ICON_PIXELS[] = {
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,
+		255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,
+		255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,
+		255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,
+		255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,
+		255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,
+		255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,
+		255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,
+		255,255,255,0,0,0,0,255,0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,0,0,0,255,0,0,0,255,
+		0,0,0,255,0,0,0,255,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+		255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,255,255,255,0,
+	};
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "a_game_object.h"
+#include "i_subjects.h"
+#include "input_queue.h"
+#include "mine_hash.h"
+
+#include "raylib_cpp.h"
+#include "vec2.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+// A board without edges. Whether a cell has a mine is worked out from the seed and the cell's coordinates when
+// it's needed, so the mines are never stored. The only thing that is stored is what the player has done:
+// cells live in fixed size chunks, which are only created once a cell in them gets opened or flagged.
+// The chunks come from a pool that's allocated along with the board, so playing never allocates. Once every chunk in
+// it is used, the cells that would need a new one can't be opened or flagged anymore.
+class EndlessBoard final : AGameObject,
+                           ISubjectGameStart, ISubjectFlagCell, ISubjectBoardMouseButtonDown, ISubjectGameLose
+{
+public:
+	EndlessBoard(Vec2<int> screenPos, int cellSize, int viewWidthCells, int viewHeightCells, double mineDensity);
+	~EndlessBoard() override;
+	EndlessBoard(const EndlessBoard&) = delete;
+	EndlessBoard& operator=(const EndlessBoard&) = delete;
+	EndlessBoard(EndlessBoard&&) = delete;
+	EndlessBoard& operator=(EndlessBoard&&) = delete;
+
+	void Update() override;
+	void Draw() const override;
+	void Reset() override;
+	using AGameObject::SetLayout;
+
+	void Attach(IObserver* observer) override;
+	void Detach(IObserver* observer) override;
+	void NotifyFlagToggleObservers() override; // Endless boards have no mine total, so this reports the amount of flags instead
+
+	[[nodiscard]] bool IsGameInProgress() const { return boardState == IN_PROGRESS; }
+	[[nodiscard]] size_t GetChunkCount() const { return chunksAmount; }
+
+private:
+	enum BoardState
+	{
+		LAYOUT_UNINITIALIZED,
+		IN_PROGRESS,
+		GAME_LOST
+	};
+
+	static constexpr int CHUNK_SIZE = 64;
+	static constexpr int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+
+	// 4 MiB, over four million cells, far more than anyone opens by hand.
+	// It also stops a reveal on a board with so few mines that it would never end
+	static constexpr size_t MAX_CHUNKS = 1024;
+	static constexpr size_t CHUNK_SLOTS = MAX_CHUNKS * 2; // A power of two, so the table is never more than half full
+	static constexpr size_t NO_CHUNK = SIZE_MAX;
+
+	// The reveal stack never grows past this, see RevealCells
+	static constexpr size_t REVEAL_STACK_CAPACITY = 1 << 16;
+
+	// Every cell is a single byte, the lowest 4 bits are the amount of adjacent mines, which is only known once
+	// the cell has been opened. Cells in chunks that don't exist are all zero, i.e. closed and unflagged
+	static constexpr uint8_t ADJACENT_MINES_MASK = 0x0F;
+	static constexpr uint8_t CELL_OPEN = 1 << 4;
+	static constexpr uint8_t CELL_FLAGGED = 1 << 5;
+	static constexpr uint8_t CELL_EXPLODED = 1 << 6;
+
+	struct Chunk
+	{
+		Vec2<int> coordinate = {};
+		std::array<uint8_t, CHUNK_CELLS> cells = {};
+	};
+
+	// Where a chunk is in the pool is found in an open addressing table, keyed by the chunk's coordinate
+	struct ChunkSlot
+	{
+		Vec2<int> coordinate = {};
+		size_t chunkIndex = NO_CHUNK;
+	};
+
+	BoardState boardState = LAYOUT_UNINITIALIZED;
+	std::unique_ptr<Chunk[]> chunks; // MAX_CHUNKS of them, the first chunksAmount are in use
+	size_t chunksAmount = 0;
+	std::vector<ChunkSlot> chunkSlots = {};
+	const Vec2<int> viewSizeCells;
+	const double mineDensity;
+	MineHash mines = {}; // Has no mines until the first click picks the seed
+	Vector2 cameraPositionCells = {0, 0}; // The world position of the view's top left corner, in cells
+	Vec2<int> viewOriginCells = {0, 0};   // The camera position, rounded down to whole cells
+	int64_t flagsPlaced = 0;
+
+	bool isMouseOnBoard = false;
+	Vec2<int> mouseSelectedCell = {};
+	bool isPreviewingClick = false;
+	bool isPreviewingChord = false;
+
+	std::vector<Vec2<int>> revealStack = {};
+	bool isRevealStackOverflowed = false;
+
+	std::list<IObserver*> observers = {};
+
+	void NotifyGameStartObservers() override;
+	void NotifyBoardMouseButtonDownObservers() override;
+	void NotifyGameLostObservers() override;
+
+	void MoveCamera();
+	void ProcessInput(const MouseState& mouseState);
+	void StartGame(const Vec2<int>& firstCell);
+	void OpenCell(const Vec2<int>& cellPosition);
+	void RevealCells(const Vec2<int>& startCell);
+	void ChordCell(const Vec2<int>& cellPosition);
+	void ToggleFlag(const Vec2<int>& cellPosition);
+	void LoseGame();
+
+	[[nodiscard]] static Vec2<int> GetChunkCoordinate(const Vec2<int>& cellPosition);
+	[[nodiscard]] static int GetIndexInChunk(const Vec2<int>& cellPosition);
+	[[nodiscard]] static size_t GetHomeChunkSlot(const Vec2<int>& chunkCoordinate);
+	[[nodiscard]] size_t FindChunkSlot(const Vec2<int>& chunkCoordinate) const; // The chunk's slot, or the empty one it'd go in
+	[[nodiscard]] Chunk* GetOrCreateChunk(const Vec2<int>& chunkCoordinate);   // Nullptr once the pool has run out
+	[[nodiscard]] uint8_t* GetCell(const Vec2<int>& cellPosition); // Creates the cell's chunk if needed, so it can be nullptr
+	[[nodiscard]] uint8_t GetCellState(const Vec2<int>& cellPosition) const; // Never creates a chunk
+	[[nodiscard]] uint8_t CountAdjacentMines(const Vec2<int>& cellPosition) const;
+
+	// Calls callback(adjacentCellPosition) for every cell around the given cell.
+	// There are no edges, so every cell has exactly 8 neighbors
+	template <typename Callback>
+	static void ProcessCellNeighbors(const Vec2<int>& cellPosition, const Callback& callback)
+	{
+		for (int y = -1; y <= 1; ++y)
+		{
+			for (int x = -1; x <= 1; ++x)
+			{
+				if (x != 0 || y != 0)
+				{
+					callback(Vec2<int>{cellPosition.x + x, cellPosition.y + y});
+				}
+			}
+		}
+	}
+};
@@ -3,9 +3,11 @@
 #include "a_game_object.h"
 #include "i_subjects.h"
 #include "i_observers.h"
+#include "input_queue.h"
 
 #include "raylib_cpp.h"
 
+#include <array>
 #include <list>
 
 // Rectangles correspond to sprites in face_atlas.png
@@ -16,6 +18,9 @@ namespace FaceSprite
 	constexpr Rectangle SURPRISED{128, 0, 64, 64};
 	constexpr Rectangle DEAD{192, 0, 64, 64};
 	constexpr Rectangle COOL{256, 0, 64, 64};
+
+	// Indexed by FaceButton::FaceButtonState
+	constexpr std::array<Rectangle, 5> SPRITE_TABLE{CLOSED_SMILE, OPEN_SMILE, SURPRISED, DEAD, COOL};
 }
 
 class FaceButton final : AGameObject,
@@ -28,11 +33,13 @@ public:
 	void Update() override;
 	void Draw() const override;
 	void Reset() override;
+	using AGameObject::SetLayout;
 
 	void Attach(IObserver* observer) override;
 	void Detach(IObserver* observer) override;
 
 private:
+	// The order must match FaceSprite::SPRITE_TABLE
 	enum FaceButtonState
 	{
 		CLOSED_SMILE,
@@ -46,12 +53,11 @@ private:
 	FaceButtonState faceButtonState = CLOSED_SMILE;
 	bool isGameWon = false;
 	bool isGameLost = false;
-	const int widthPixels;
-	const int heightPixels;
 
 	void ResetFaceButtonSpriteState();
-	void ProcessInput();
+	void ProcessInput(const MouseState& mouseState);
 	[[nodiscard]] Rectangle GetFaceSprite() const;
+	[[nodiscard]] int GetSizePixels() const { return 2 * cellSizePixels; }
 
 	void NotifyGameRestartObservers() override;
 
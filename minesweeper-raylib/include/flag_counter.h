@@ -14,9 +14,10 @@ public:
 	void Update() override;
 	void Draw() const override;
 	void Reset() override;
+	using AGameObject::SetLayout;
 
 private:
-	int unflaggedMines = 0;
+	int64_t unflaggedMines = 0; // Only the last three digits fit on the counter
 
-	void OnToggledCellFlag(const int& minesLeftToFlag) override;
+	void OnToggledCellFlag(const int64_t& minesLeftToFlag) override;
 };
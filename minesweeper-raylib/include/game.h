@@ -1,17 +1,19 @@
 #pragma once
 
-#include "board.h"
-#include "timer.h"
-#include "flag_counter.h"
-#include "face_button.h"
+#include "game_session.h"
+#include "latency_profiler.h"
 
+#include <memory>
 #include <string>
+#include <vector>
 
-class Game final : public IObserverGameRestart, public IObserverGameWon, public IObserverGameLost
+// The window, and the game sessions in it. A single session fills the window like it always has,
+// split screen sessions are laid out in a grid, all with the same cell size so they share the scaled atlases
+class Game final
 {
 public:
-	Game(int fps, const std::string& title, int cellSize, int boardWidth, int boardHeight, int maxMinesAmount);
-	~Game() noexcept override;
+	Game(int fps, const std::string& title, int cellSize, size_t boardWidth, size_t boardHeight, uint64_t maxMinesAmount, bool autoChord, bool endless, double endlessMineDensity, bool vsync, bool latencyProfiling, bool threadedSimulation, const std::string& sharedBoardName, int sessionsAmount);
+	~Game() noexcept;
 	Game(const Game&) = delete;
 	Game& operator=(const Game&) = delete;
 	Game(const Game&&) = delete;
@@ -21,22 +23,21 @@ public:
 	void Tick();
 
 private:
-	const int cellSizePixels;
-	const int borderThicknessPixels;
-	const int boardWidthCells;
+	const double frameDurationSeconds;
+	double nextFrameTime = 0; // When the next frame is due, in seconds since the window was opened
+	int cellSizePixels;
+	int borderThicknessPixels;
+	const int boardWidthCells;  // How many cells each session is laid out for, which can be less than the board has
 	const int boardHeightCells;
-	Board board;
-	FlagCounter flagCounter;
-	FaceButton faceButton;
-	Timer timer;
-
-	bool isGameWon = false;
-	bool isGameLost = false;
-
+	std::vector<std::unique_ptr<GameSession>> sessions;
+	std::unique_ptr<LatencyProfiler> latencyProfiler; // Only exists when latency profiling is turned on, measures every session
+	Vector2 windowScaleDpi{1, 1};
+#if defined DEBUG
+	bool hasPresentedFirstFrame = false;
+#endif
+
+	[[nodiscard]] bool IsEveryGameInProgress() const;
 	void Update();
 	void Draw() const;
-
-	void OnGameRestarted() override;
-	void OnGameWon() override;
-	void OnGameLost() override;
+	void UpdateLayout();
 };
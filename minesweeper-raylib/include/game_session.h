@@ -0,0 +1,80 @@
+#pragma once
+
+#include "board_simulation.h"
+#include "endless_board.h"
+#include "timer.h"
+#include "flag_counter.h"
+#include "face_button.h"
+#include "minimap.h"
+
+#include "vec2.h"
+
+#include <memory>
+#include <string>
+
+// One game of minesweeper with its own board, flag counter, face button, timer and minimap, laid out like the
+// whole window used to be, starting from the session's top left corner. Sessions never know about each other,
+// so several of them can be played side by side in the same window, each started, won and lost on its own.
+class GameSession final : public IObserverGameRestart, public IObserverGameWon, public IObserverGameLost, public IObserverSnapshotLoad
+{
+public:
+	// The parts of a session are drawn one layer at a time for every session, so that everything drawn from the
+	// same texture is drawn together, which raylib turns into a single draw call however many sessions there are
+	enum DrawLayer : uint8_t
+	{
+		FRAME,   // Drawn from raylib's shapes texture
+		BOARD,   // Cell atlas
+		DIGITS,  // Digits atlas
+		FACE,    // Face atlas
+		MINIMAP, // Every minimap has a texture of its own
+		DRAW_LAYER_COUNT
+	};
+
+	GameSession(Vec2<int> topLeftPixels,
+	            int cellSize,
+	            size_t boardWidth,
+	            size_t boardHeight,
+	            uint64_t maxMinesAmount,
+	            bool autoChord,
+	            bool endless,
+	            double endlessMineDensity,
+	            bool threadedSimulation,
+	            const std::string& sharedBoardName);
+	GameSession(const GameSession&) = delete;
+	GameSession& operator=(const GameSession&) = delete;
+	GameSession(GameSession&&) = delete;
+	GameSession& operator=(GameSession&&) = delete;
+
+	// Only the session with the keyboard focus takes the shortcuts
+	void Update(const bool& hasKeyboardFocus);
+	void Draw(const DrawLayer& layer) const;
+	void SetLayout(const Vec2<int>& topLeftPixels, const int& cellSize);
+
+	[[nodiscard]] bool IsGameInProgress() const;
+	[[nodiscard]] bool ContainsPoint(const Vec2<int>& pointPixels) const;
+	[[nodiscard]] double TakeChangingInputTime() { return board.TakeChangingInputTime(); } // See Board::TakeChangingInputTime
+	[[nodiscard]] Vec2<int> GetBoardScreenPosition() const;
+
+private:
+	Vec2<int> topLeftPixels;
+	int cellSizePixels;
+	int borderThicknessPixels;
+	const int boardWidthCells;  // How many cells the session is laid out for, which can be less than the board has
+	const int boardHeightCells;
+	BoardSimulation board;
+	std::unique_ptr<EndlessBoard> endlessBoard; // Only exists in endless mode, which leaves the regular board unused
+	FlagCounter flagCounter;
+	FaceButton faceButton;
+	Timer timer;
+	Minimap minimap; // Only shows the regular board
+
+	bool isGameWon = false;
+	bool isGameLost = false;
+
+	void UpdateShortcuts();
+
+	void OnGameRestarted() override;
+	void OnGameWon() override;
+	void OnGameLost() override;
+	void OnSnapshotLoaded(const double& timeElapsed) override;
+};
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
 class IObserver
 {
 protected:
@@ -33,7 +37,7 @@ public:
 class IObserverFlagToggle : public virtual IObserver
 {
 public:
-	virtual void OnToggledCellFlag(const int& minesLeftToFlag) = 0;
+	virtual void OnToggledCellFlag(const int64_t& minesLeftToFlag) = 0;
 };
 
 class IObserverBoardMouseButtonDown : public virtual IObserver
@@ -41,3 +45,34 @@ class IObserverBoardMouseButtonDown : public virtual IObserver
 public:
 	virtual void OnBoardMouseButtonDown() = 0;
 };
+
+class IObserverSnapshotLoad : public virtual IObserver
+{
+public:
+	virtual void OnSnapshotLoaded(const double& timeElapsed) = 0; // The loaded game was timeElapsed seconds in
+};
+
+// A run of cells that were opened, closed or (un)flagged one after another, like a row of a reveal.
+// The cells are firstCellIndex up to firstCellIndex + cellsAmount, where an index is y * boardWidth + x,
+// so a run can go on into the next row
+struct CellChange
+{
+	enum Type : uint8_t
+	{
+		OPENED,
+		CLOSED,
+		FLAGGED,
+		UNFLAGGED
+	};
+
+	size_t firstCellIndex;
+	size_t cellsAmount;
+	Type type;
+};
+
+class IObserverCellChange : public virtual IObserver
+{
+public:
+	virtual void OnCellsChanged(std::span<const CellChange> changes) = 0; // Every change since the last notification, in order
+	virtual void OnBoardCleared() = 0; // Every cell was closed and unflagged at once
+};
@@ -46,3 +46,10 @@ class ISubjectBoardMouseButtonDown : public ISubject
 protected:
 	virtual void NotifyBoardMouseButtonDownObservers() = 0;
 };
+
+class ISubjectCellChange : public ISubject
+{
+protected:
+	virtual void NotifyCellChangeObservers() = 0;
+	virtual void NotifyBoardClearedObservers() = 0;
+};
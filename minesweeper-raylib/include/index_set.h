@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+// A set of cell indices, with constant time insertion, removal and lookup.
+// The indices are kept packed in one array, so walking the set only visits the indices that are in it.
+// Where each index is in that array is kept in an open addressing hash table instead of an array as large as
+// the board, so the set's memory only depends on how many indices it can hold, even on boards with billions of cells.
+// That's fixed when the set is made, the set never grows, so changing it never allocates.
+class IndexSet
+{
+public:
+	IndexSet() = default;
+
+	// A set that can't hold anything, whose memory comes from the given resource once it's given a capacity
+	explicit IndexSet(std::pmr::memory_resource* memory)
+		: indices(memory),
+		  slots(memory)
+	{
+	}
+
+	// All the memory for at least the given amount of indices is allocated up front
+	explicit IndexSet(const size_t capacity, std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+		: indices(memory),
+		  slots(memory)
+	{
+		ResizeSlots(capacity * 2);
+	}
+
+	// How much memory a set allocates up front for the given amount of indices
+	[[nodiscard]] static constexpr size_t GetReservedBytes(const size_t capacity)
+	{
+		const size_t slotAmount = std::max(MIN_SLOTS, std::bit_ceil(capacity * 2));
+		return slotAmount / 2 * sizeof(size_t) + slotAmount * sizeof(Slot);
+	}
+
+	[[nodiscard]] bool Contains(const size_t index) const
+	{
+		return !slots.empty() && slots[FindSlot(index)].index == index;
+	}
+
+	// Returns false if the set is full and doesn't have the index yet, the index isn't added then
+	[[nodiscard]] bool Insert(const size_t index)
+	{
+		assert(index != EMPTY_SLOT && "Index is out of the set's range");
+
+		if (Contains(index))
+		{
+			return true;
+		}
+
+		if (IsFull())
+		{
+			return false;
+		}
+
+		slots[FindSlot(index)] = Slot{index, indices.size()};
+		indices.push_back(index);
+
+		return true;
+	}
+
+	// Moves the last index into the erased index's place, so the order of the indices changes
+	void Erase(const size_t index)
+	{
+		if (!Contains(index))
+		{
+			return;
+		}
+
+		const size_t erasedSlot = FindSlot(index);
+		const size_t position = slots[erasedSlot].position;
+		const size_t lastIndex = indices.back();
+
+		indices[position] = lastIndex;
+		slots[FindSlot(lastIndex)].position = position;
+		indices.pop_back();
+		RemoveSlot(erasedSlot);
+	}
+
+	// Only touches the indices that are in the set, not the whole table. The slots are removed like in Erase,
+	// since just emptying them would cut off the probe sequences of the indices that haven't been removed yet
+	void Clear()
+	{
+		for (const size_t index : indices)
+		{
+			RemoveSlot(FindSlot(index));
+		}
+
+		indices.clear();
+	}
+
+	[[nodiscard]] size_t GetSize() const { return indices.size(); }
+	[[nodiscard]] bool IsEmpty() const { return indices.empty(); }
+	[[nodiscard]] bool IsFull() const { return (indices.size() + 1) * 2 > slots.size(); }
+	[[nodiscard]] std::span<const size_t> GetIndices() const { return indices; }
+	[[nodiscard]] std::pmr::vector<size_t>::const_iterator begin() const { return indices.begin(); }
+	[[nodiscard]] std::pmr::vector<size_t>::const_iterator end() const { return indices.end(); }
+
+private:
+	static constexpr size_t EMPTY_SLOT = SIZE_MAX;
+	static constexpr size_t MIN_SLOTS = 16;
+
+	struct Slot
+	{
+		size_t index = EMPTY_SLOT;
+		size_t position = 0; // Where the index is in the indices array
+	};
+
+	std::pmr::vector<size_t> indices = {}; // The indices in the set, packed
+	std::pmr::vector<Slot> slots = {};     // Always a power of two long, and at most half full
+	int slotShift = 64;
+
+	// Fibonacci hashing, so that neighboring cells end up far apart in the table
+	[[nodiscard]] size_t GetHomeSlot(const size_t index) const
+	{
+		return static_cast<size_t>((static_cast<uint64_t>(index) * 0x9E3779B97F4A7C15) >> slotShift);
+	}
+
+	// Returns the slot that holds the index, or the empty slot where it would go
+	[[nodiscard]] size_t FindSlot(const size_t index) const
+	{
+		const size_t mask = slots.size() - 1;
+		size_t slot = GetHomeSlot(index);
+
+		while (slots[slot].index != index && slots[slot].index != EMPTY_SLOT)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		return slot;
+	}
+
+	// Shifts the following indices back into the hole, so lookups never have to skip over removed slots
+	void RemoveSlot(size_t hole)
+	{
+		const size_t mask = slots.size() - 1;
+		size_t slot = (hole + 1) & mask;
+
+		while (slots[slot].index != EMPTY_SLOT)
+		{
+			// An index can only move back if the hole isn't before its home slot
+			const size_t homeSlot = GetHomeSlot(slots[slot].index);
+			if (((slot - homeSlot) & mask) >= ((slot - hole) & mask))
+			{
+				slots[hole] = slots[slot];
+				hole = slot;
+			}
+
+			slot = (slot + 1) & mask;
+		}
+
+		slots[hole].index = EMPTY_SLOT;
+	}
+
+	// Only called while the set is made, when it doesn't have any indices yet.
+	// The slots are never more than half full, so the indices never need more than half as many entries
+	void ResizeSlots(const size_t minimumSlots)
+	{
+		size_t slotAmount = MIN_SLOTS;
+		slotShift = 64 - 4;
+		while (slotAmount < minimumSlots)
+		{
+			slotAmount *= 2;
+			slotShift--;
+		}
+
+		indices.reserve(slotAmount / 2);
+		slots.assign(slotAmount, Slot{});
+	}
+};
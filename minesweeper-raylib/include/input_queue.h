@@ -0,0 +1,60 @@
+#pragma once
+
+#include "vec2.h"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// What the mouse looked like right after a button changed, or at the start of the frame
+struct MouseState
+{
+	std::array<bool, 3> buttonsDown = {};
+	std::array<bool, 3> buttonsReleased = {}; // Only set on the state of the event that released the button
+	Vec2<int> position = {};
+	double time = 0; // Seconds since the window was opened
+
+	[[nodiscard]] bool IsButtonDown(const int button) const { return buttonsDown[button]; }
+	[[nodiscard]] bool IsButtonReleased(const int button) const { return buttonsReleased[button]; }
+};
+
+// Raylib only looks at the OS events once per frame, so a press and a release that land between the same two frames
+// look like they happened at the same time. The queue polls the events at a fixed rate between frames instead, and
+// keeps every button change in the order it happened in, with the time and mouse position it happened at.
+// Key presses and window resizes are kept as well, since raylib forgets them on every poll.
+class InputQueue
+{
+public:
+	InputQueue(const InputQueue&) = delete;
+	InputQueue& operator=(const InputQueue&) = delete;
+	InputQueue(const InputQueue&&) = delete;
+	InputQueue& operator=(const InputQueue&&) = delete;
+
+	static InputQueue& GetInstance();
+
+	void Sample(); // Records anything that changed since the last sample, the events have to be polled before this
+	void WaitForNextFrame(double nextFrameTime); // Keeps polling and sampling the input until it's time to draw again
+	void BeginFrame(); // Appends the current state, so the frame sees where the mouse is now
+	void EndFrame();   // Drops everything the frame has consumed
+
+	// Every button change since the last frame in order, followed by the current state
+	[[nodiscard]] std::span<const MouseState> GetMouseStates() const { return mouseStates; }
+	[[nodiscard]] bool IsKeyPressed(int key) const; // Whether the key was pressed at any point since the last frame
+	[[nodiscard]] bool IsWindowResized() const { return isWindowResized; }
+
+private:
+	static constexpr size_t MOUSE_STATES_CAPACITY = 256;
+	static constexpr size_t KEYS_PRESSED_CAPACITY = 16;
+
+	std::vector<MouseState> mouseStates = {};
+	MouseState currentState = {};
+	std::array<int, KEYS_PRESSED_CAPACITY> keysPressed = {};
+	size_t keysPressedAmount = 0;
+	bool isWindowResized = false;
+
+	InputQueue();
+	~InputQueue() = default;
+
+	void PushMouseState(const MouseState& mouseState);
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "a_game_object.h"
+
+#include "vec2.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Collects how long it takes from a mouse event arriving to the frame with its cell changes being presented.
+// The histogram is drawn as an overlay on top of the board, and written to a file when the game closes, together
+// with the settings it was measured with, so runs with different settings can be compared afterwards.
+class LatencyProfiler final : AGameObject
+{
+public:
+	LatencyProfiler(const Vec2<int>& screenPos, const int& cellSize, std::string configurationName);
+
+	void Update() override; // Toggles the overlay
+	void Draw() const override;
+	void Reset() override;
+	using AGameObject::SetLayout;
+
+	void RecordLatency(double latencySeconds);
+	[[nodiscard]] bool WriteHistogram(const std::string& filePath) const;
+
+private:
+	static constexpr double BUCKET_MILLISECONDS = 0.5;
+	static constexpr size_t BUCKETS_AMOUNT = 200; // The last bucket also holds everything slower than that
+
+	const std::string configurationName;
+	std::array<uint64_t, BUCKETS_AMOUNT> buckets = {};
+	uint64_t samplesAmount = 0;
+	double totalMilliseconds = 0;
+	double maxMilliseconds = 0;
+	bool isOverlayVisible = false;
+
+	[[nodiscard]] double GetPercentileMilliseconds(double percentile) const; // The upper edge of the percentile's bucket
+};
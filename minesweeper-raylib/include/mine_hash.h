@@ -0,0 +1,72 @@
+#pragma once
+
+#include "vec2.h"
+
+#include <cstdint>
+#include <cstdlib>
+
+// Answers whether a cell has a mine straight from the seed and the cell's coordinates, so no mine layout
+// has to be generated or stored, and any cell can be asked about in any order.
+// A default constructed MineHash has no mines at all.
+class MineHash
+{
+public:
+	MineHash() = default;
+
+	// The safe cell and its neighbors never have mines, which is what keeps the first click safe
+	MineHash(const uint64_t seed, const double mineDensity, const Vec2<int>& safeCell)
+		: seed(seed),
+		  mineThreshold(GetMineThreshold(mineDensity)),
+		  safeCell(safeCell)
+	{
+	}
+
+	[[nodiscard]] bool HasMine(const Vec2<int>& cellPosition) const
+	{
+		if (std::abs(cellPosition.x - safeCell.x) <= 1 && std::abs(cellPosition.y - safeCell.y) <= 1)
+		{
+			return false;
+		}
+
+		return HashCoordinate(seed, cellPosition) < mineThreshold;
+	}
+
+	// SplitMix64's finalizer over the packed coordinates, which is enough to make neighboring cells unrelated
+	[[nodiscard]] static constexpr uint64_t HashCoordinate(const uint64_t seed, const Vec2<int>& coordinate)
+	{
+		const uint64_t packedCoordinate = static_cast<uint64_t>(static_cast<uint32_t>(coordinate.x)) << 32
+			| static_cast<uint32_t>(coordinate.y);
+
+		uint64_t hash = packedCoordinate ^ MixBits(seed);
+		hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9;
+		hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EB;
+		return hash ^ (hash >> 31);
+	}
+
+private:
+	uint64_t seed = 0;
+	uint64_t mineThreshold = 0; // A cell has a mine if its hash is below this
+	Vec2<int> safeCell = {};
+
+	[[nodiscard]] static constexpr uint64_t MixBits(uint64_t value)
+	{
+		value += 0x9E3779B97F4A7C15;
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+		return value ^ (value >> 31);
+	}
+
+	[[nodiscard]] static constexpr uint64_t GetMineThreshold(const double mineDensity)
+	{
+		if (mineDensity <= 0.0)
+		{
+			return 0;
+		}
+		if (mineDensity >= 1.0)
+		{
+			return UINT64_MAX;
+		}
+
+		return static_cast<uint64_t>(mineDensity * 18446744073709551616.0); // 2^64
+	}
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "a_game_object.h"
+#include "i_observers.h"
+#include "index_set.h"
+
+#include <raylib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// A small overview of the whole board in the header, with one pixel per cell, or per block of cells on boards
+// too large for that. It only learns about the board through cell change events, and keeps how many cells of
+// every block are open and flagged, so each change only touches its own pixel. Only the pixels that changed
+// since the last frame are uploaded to the texture.
+class Minimap final : AGameObject,
+                      public IObserverCellChange
+{
+public:
+	Minimap(const Vec2<int>& screenPos, const int& cellSize, size_t boardWidthCells, size_t boardHeightCells, Vec2<int> viewSizeCells);
+	~Minimap() override;
+	Minimap(const Minimap&) = delete;
+	Minimap& operator=(const Minimap&) = delete;
+	Minimap(Minimap&&) = delete;
+	Minimap& operator=(Minimap&&) = delete;
+
+	void Update() override; // Uploads the changed pixels, which needs the window to exist
+	void Draw() const override;
+	void Reset() override;
+	using AGameObject::SetLayout;
+
+private:
+	const size_t boardWidthCells;
+	const size_t boardHeightCells;
+	const Vec2<int> viewSizeCells; // The part of the board that the window shows, starting from the top left
+	const size_t blockSizeCells;   // Every pixel covers this many cells in both directions
+	const Vec2<int> textureSize;
+
+	std::vector<uint32_t> openCells = {};    // Per block
+	std::vector<uint32_t> flaggedCells = {}; // Per block
+	std::vector<Color> pixels = {};
+	std::vector<Color> uploadBuffer = {}; // Changed pixels are gathered here, so they can be uploaded in one go
+	IndexSet changedBlocks;
+	bool isWholeTextureChanged = true;
+	Texture2D texture{};
+
+	void OnCellsChanged(std::span<const CellChange> changes) override;
+	void OnBoardCleared() override;
+
+	[[nodiscard]] size_t GetBlockIndex(const size_t& cellIndex) const;
+	[[nodiscard]] uint64_t GetBlockCellsAmount(const size_t& blockIndex) const;
+	[[nodiscard]] Color GetBlockColor(const size_t& blockIndex) const;
+	void UploadChangedPixels();
+};
@@ -11,7 +11,9 @@ namespace RaylibCpp
 	constexpr int MOUSE_MIDDLE_CLICK = 2;
 
 	void DrawLineEx(const Vec2<int>& startPos, const Vec2<int>& endPos, int lineThick, const Color& color);
+	void DrawRectangle(const Vec2<int>& pos, const Vec2<int>& widthHeight, const Color& color);
 	void DrawRectangleLinesEx(Vec2<int> pos, Vec2<int> widthHeight, int lineThick, Color color);
+	void DrawText(const char* text, const Vec2<int>& pos, int fontSize, const Color& color);
 	void DrawTexturePro(const Texture& texture,
 	                    const Rectangle& spriteRect,
 	                    const Vec2<int>& destTopLeft,
@@ -19,4 +21,5 @@ namespace RaylibCpp
 	                    const Vec2<int>& origin,
 	                    float rotation,
 	                    const Color& color);
+	void DrawTextureRec(const Texture& texture, const Rectangle& spriteRect, const Vec2<int>& destTopLeft, const Color& color);
 }
@@ -1,10 +1,25 @@
 #pragma once
 
+#include "vec2.h"
+
 #include <raylib.h>
 
 class ResourcesSingleton
 {
 public:
+	// The atlases rescaled so that a 32x32 pixel unit of the source images is exactly one cell wide,
+	// which means every sprite can be drawn as a 1:1 blit without any scaling on the GPU
+	struct ScaledAtlases
+	{
+		int cellSizePixels = 0;
+		Texture2D cellAtlasTexture{};
+		Texture2D digitsAtlasTexture{};
+		Texture2D faceAtlasTexture{};
+
+		// Converts a sprite rectangle of the source atlas to the matching rectangle in the scaled atlas
+		[[nodiscard]] Rectangle GetSprite(const Rectangle& atlasSprite) const;
+	};
+
 	ResourcesSingleton(const ResourcesSingleton&) = delete;
 	ResourcesSingleton& operator=(const ResourcesSingleton&) = delete;
 	ResourcesSingleton(const ResourcesSingleton&&) = delete;
@@ -12,15 +27,18 @@ public:
 
 	static ResourcesSingleton& GetInstance();
 
-	Texture2D& GetCellAtlasTexture();
-	Texture2D& GetDigitsAtlasTexture();
-	Texture2D& GetFaceAtlasTexture();
+	// The atlases are rebuilt lazily whenever they're requested with a different cell size than the cached one
+	const ScaledAtlases& GetScaledAtlases(int cellSizePixels);
+
+	static Image GetEmbeddedImage(const unsigned char* pixels, int width, int height);
+	static Image GetIconImage(); // Doesn't need the window to exist or the singleton to be constructed
 
 private:
-	Texture2D cellAtlasTexture{};
-	Texture2D digitsAtlasTexture{};
-	Texture2D faceAtlasTexture{};
+	ScaledAtlases scaledAtlases{};
 
-	ResourcesSingleton();
+	ResourcesSingleton() = default;
 	~ResourcesSingleton();
+
+	void UnloadScaledAtlases();
+	static Texture2D LoadScaledAtlasTexture(const Image& atlas, const Vec2<int>& spriteSize, int cellSizePixels);
 };
@@ -4,10 +4,43 @@
 
 #include <raylib.h>
 
+#include <array>
+#include <cstdint>
+
 namespace Settings
 {
 	// Window settings
 	constexpr int FPS = 60;
+	constexpr int MIN_RESIZED_CELL_SIZE_PIXELS = 2; // The window can be shrunk until the cells are this small
+
+	// Input settings
+	constexpr int INPUT_SAMPLE_RATE = 1000; // How many times per second the input is polled between frames
+
+	// Save settings
+	constexpr const char* SAVE_FILE_PATH = "savegame.bin";
+	constexpr int SAVE_GAME_KEY = KEY_F5;
+	constexpr int LOAD_GAME_KEY = KEY_F9;
+
+	// Undo settings, both are used together with the control key
+	constexpr int UNDO_KEY = KEY_Z;
+	constexpr int REDO_KEY = KEY_Y;
+
+	// Hint settings
+	constexpr int HINT_KEY = KEY_H;
+	constexpr Color HINT_OUTLINE_COLOR = GREEN;
+
+	// Minimap settings
+	constexpr int MINIMAP_MAX_TEXTURE_SIZE = 512; // Boards larger than this get one minimap pixel per block of cells
+	constexpr Color MINIMAP_CLOSED_COLOR{120, 120, 120, 255};
+	constexpr Color MINIMAP_OPEN_COLOR{200, 200, 200, 255};
+	constexpr Color MINIMAP_FLAGGED_COLOR = RED;
+	constexpr Color MINIMAP_VIEW_OUTLINE_COLOR = YELLOW;
+
+	// Latency profiling settings, only used if latency profiling is turned on in the config
+	constexpr int PROFILER_OVERLAY_KEY = KEY_F3;
+	constexpr const char* LATENCY_HISTOGRAM_FILE_PATH = "latency_histogram.csv";
+	constexpr Color PROFILER_BACKGROUND_COLOR{0, 0, 0, 200};
+	constexpr Color PROFILER_BAR_COLOR = SKYBLUE;
 
 	// Game settings
 	enum Difficulty
@@ -16,7 +49,8 @@ namespace Settings
 		BEGINNER,
 		INTERMEDIATE,
 		EXPERT,
-		CUSTOM
+		CUSTOM,
+		ENDLESS
 	};
 
 	constexpr Vec2<int> BEGINNER_BOARD_DIMENSIONS{9};
@@ -28,6 +62,25 @@ namespace Settings
 	constexpr Vec2<int> EXPERT_BOARD_DIMENSIONS{30, 16};
 	constexpr int EXPERT_MINES_TOTAL = 99;
 
+	// Custom boards can be this many cells wide and tall, as long as all of the window's boards together take at most
+	// MAX_BOARDS_MEMORY_BYTES, see Board::GetMemoryFootprint. That's three quarters of a byte per cell, so a single board
+	// can have about 11 billion cells, with 3 more bytes per cell if it's shared with bots.
+	// The window is never laid out for more than MAX_LAYOUT_BOARD_DIMENSION_CELLS along either side,
+	// anything further than that is cut off at the window's edge
+	constexpr int64_t MAX_BOARD_DIMENSION_CELLS = UINT32_MAX;
+	constexpr uint64_t MAX_BOARDS_MEMORY_BYTES = uint64_t{8} << 30;
+	constexpr int MAX_LAYOUT_BOARD_DIMENSION_CELLS = 1024;
+
+	// Endless boards show a window into the board the size of an expert board, which can be moved around
+	constexpr Vec2<int> ENDLESS_VIEW_DIMENSIONS{30, 16};
+	constexpr double ENDLESS_DEFAULT_MINE_DENSITY = 0.16; // Close to the expert difficulty's density
+	constexpr double ENDLESS_MIN_MINE_DENSITY = 0.12; // Any lower and empty areas get so large that a single click could open most of the world
+	constexpr double ENDLESS_MAX_MINE_DENSITY = 0.5;
+	constexpr float ENDLESS_CAMERA_SPEED_CELLS = 15.0f; // Per second
+
+	// Split screen games are laid out in a grid that's as close to square as it gets, filled row by row
+	constexpr int MAX_SPLIT_SCREEN_SESSIONS = 64;
+
 	static int GetDifficultyBoardWidth(const Difficulty difficulty)
 	{
 		if (difficulty == BEGINNER)
@@ -38,6 +91,10 @@ namespace Settings
 		{
 			return INTERMEDIATE_BOARD_DIMENSIONS.x;
 		}
+		if (difficulty == ENDLESS)
+		{
+			return ENDLESS_VIEW_DIMENSIONS.x;
+		}
 		return EXPERT_BOARD_DIMENSIONS.x;
 	};
 
@@ -51,6 +108,10 @@ namespace Settings
 		{
 			return INTERMEDIATE_BOARD_DIMENSIONS.y;
 		}
+		if (difficulty == ENDLESS)
+		{
+			return ENDLESS_VIEW_DIMENSIONS.y;
+		}
 		return EXPERT_BOARD_DIMENSIONS.y;
 	};
 
@@ -64,11 +125,57 @@ namespace Settings
 		{
 			return INTERMEDIATE_MINES_TOTAL;
 		}
+		if (difficulty == ENDLESS)
+		{
+			return 0; // Endless boards place their mines by density instead
+		}
 		return EXPERT_MINES_TOTAL;
 	};
 
 
 	// Utils
+	static Vec2<int> GetWindowSize(const int cellSizePixels,
+	                               const int borderThicknessPixels,
+	                               const int boardWidthCells,
+	                               const int boardHeightCells)
+	{
+		return Vec2<int>{
+			boardWidthCells * cellSizePixels + cellSizePixels,
+			boardHeightCells * cellSizePixels + cellSizePixels * 4 + borderThicknessPixels
+		};
+	}
+
+	// The largest cell size at which the whole layout still fits into the window
+	static int GetCellSizeToFitWindow(const Vec2<int>& windowSizePixels, const int boardWidthCells, const int boardHeightCells)
+	{
+		// The layout is (boardWidthCells + 1) cells wide and (boardHeightCells + 4.5) cells tall
+		const int fitWidth = windowSizePixels.x / (boardWidthCells + 1);
+		const int fitHeight = windowSizePixels.y * 2 / (boardHeightCells * 2 + 9);
+		const int cellSizePixels = fitWidth < fitHeight ? fitWidth : fitHeight;
+
+		return cellSizePixels > MIN_RESIZED_CELL_SIZE_PIXELS ? cellSizePixels : MIN_RESIZED_CELL_SIZE_PIXELS;
+	}
+
+	// How many sessions go side by side (x) and how many rows of them there are (y)
+	static Vec2<int> GetSessionGridSize(const int sessionsAmount)
+	{
+		int columns = 1;
+		while (columns * columns < sessionsAmount)
+		{
+			++columns;
+		}
+
+		return Vec2<int>{columns, (sessionsAmount + columns - 1) / columns};
+	}
+
+	// Everything else is positioned relative to the top left corner of its session
+	static Vec2<int> GetSessionScreenPosition(const int sessionIndex, const int sessionsAmount, const Vec2<int>& sessionSizePixels)
+	{
+		const int columns = GetSessionGridSize(sessionsAmount).x;
+
+		return Vec2<int>{sessionIndex % columns, sessionIndex / columns} * sessionSizePixels;
+	}
+
 	static Vec2<int> GetBoardScreenPosition(const int cellSizePixels, const int borderThicknessPixels)
 	{
 		return Vec2<int>{
@@ -82,6 +189,15 @@ namespace Settings
 		return Vec2<int>{cellSizePixels};
 	}
 
+	// The minimap goes between the flag counter and the face button, and is as tall as both
+	static Vec2<int> GetMinimapScreenPosition(const int cellSizePixels)
+	{
+		return Vec2<int>{
+			cellSizePixels * 4 + cellSizePixels / 2,
+			cellSizePixels
+		};
+	}
+
 	static Vec2<int> GetFaceButtonScreenPosition(const int cellSizePixels,
 	                                             const int borderThicknessPixels,
 	                                             const int boardWidthCells)
@@ -100,8 +216,21 @@ namespace Settings
 		};
 	}
 
-	static Rectangle GetDigitSprite(const int& digit) // Used in Timer and FlagCounter, corresponds to sprites in digits_atlas.png
+	// Used in Timer and FlagCounter, corresponds to sprites in digits_atlas.png (0-9, followed by a blank and a dash)
+	constexpr auto DIGIT_SPRITES = []
+	{
+		std::array<Rectangle, 12> sprites{};
+
+		for (int digit = 0; digit < static_cast<int>(sprites.size()); ++digit)
+		{
+			sprites[digit] = Rectangle{static_cast<float>(digit) * 32, 0, 32, 64};
+		}
+
+		return sprites;
+	}();
+
+	constexpr Rectangle GetDigitSprite(const int& digit)
 	{
-		return Rectangle{static_cast<float>(digit) * 32, 0, 32, 64};
+		return DIGIT_SPRITES[digit];
 	}
 }
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "board.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// The start of a shared board segment, which bots map to see the board without asking the game for it.
+// After the header come the open, flag and number planes, a byte per cell each, row by row. A number is the
+// amount of mines around an open cell, and 0 for a closed one. The move ring comes last, at a page boundary,
+// so a bot can map everything before it read-only, and only the ring writable.
+// Bots have to be built for the same kind of machine as the game, since everything is in its byte order.
+struct SharedBoardHeader
+{
+	static constexpr uint32_t MAGIC = 0x4D53424D;
+	static constexpr uint32_t VERSION = 1;
+
+	enum State : uint8_t
+	{
+		READY,
+		PLAYING,
+		WON,
+		LOST
+	};
+
+	uint32_t magic;
+	uint32_t version;
+	uint64_t width;
+	uint64_t height;
+	uint64_t openPlaneOffset; // Offsets are in bytes from the start of the segment
+	uint64_t flagPlaneOffset;
+	uint64_t numberPlaneOffset;
+	uint64_t moveRingOffset;
+
+	// Odd while the game is writing the planes, the state or the flag count. A bot reads it before and after
+	// copying what it needs, and copies again if it was odd or has changed in between
+	alignas(64) std::atomic<uint64_t> sequence;
+	State state;
+	int64_t minesLeftToFlag;
+};
+
+// Moves from a single bot to the game, which plays them the next time the board updates, in the order they were
+// put into the ring. Moves on cells that aren't on the board, or after the game is over, do nothing
+struct SharedMoveRing
+{
+	static constexpr uint64_t CAPACITY = 1024;
+
+	alignas(64) std::atomic<uint64_t> head; // Only the bot changes this, every move before it is in the ring
+	alignas(64) std::atomic<uint64_t> tail; // Only the game changes this, every move before it has been played
+	alignas(64) BoardMove moves[CAPACITY];  // Move n is at n % CAPACITY
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "The atomics in the segment are shared with other processes");
+
+// Owns a POSIX shared memory segment with the layout above, for as long as the board it shares lives.
+// The game is the only one that writes to the planes, and only takes moves out of the ring
+class SharedBoard
+{
+public:
+	SharedBoard() = default;
+	~SharedBoard();
+	SharedBoard(const SharedBoard&) = delete;
+	SharedBoard& operator=(const SharedBoard&) = delete;
+	SharedBoard(SharedBoard&&) = delete;
+	SharedBoard& operator=(SharedBoard&&) = delete;
+
+	// Makes the segment, replacing any segment with the same name. The name starts with a slash, like /minesweeper.
+	// Returns false if it couldn't be made, or if shared memory isn't supported
+	[[nodiscard]] bool Open(const std::string& name, size_t width, size_t height);
+
+	// How large the segment for a board of this size is, which the game counts against its memory budget.
+	// Nothing is ever shared where there's no shared memory, so it's 0 there
+	[[nodiscard]] static uint64_t GetSegmentSize(const size_t& width, const size_t& height);
+
+	// The oldest move a bot has put into the ring, returns false once the ring is empty
+	[[nodiscard]] bool TakeMove(BoardMove& move);
+
+	// Writing is wrapped in these, so bots can tell when they've copied something that was being written
+	void BeginWrite();
+	void WriteCell(const size_t& cellIndex, const uint8_t& spriteKey);
+	void EndWrite(SharedBoardHeader::State state, int64_t minesLeftToFlag);
+
+private:
+	std::string segmentName;
+	void* segment = nullptr;
+	size_t segmentSize = 0;
+	SharedBoardHeader* header = nullptr;
+	uint8_t* openPlane = nullptr;
+	uint8_t* flagPlane = nullptr;
+	uint8_t* numberPlane = nullptr;
+	SharedMoveRing* moveRing = nullptr;
+};
@@ -14,6 +14,10 @@ public:
 	void Update() override;
 	void Draw() const override;
 	void Reset() override;
+	using AGameObject::SetLayout;
+
+	[[nodiscard]] double GetTimeElapsed() const;
+	void SetTimeElapsed(const double& timeElapsed); // Restarts the timer as if the game started timeElapsed seconds ago
 
 private:
 	double gameStartTime = 0;
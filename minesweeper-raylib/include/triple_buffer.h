@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Hands the newest value from one writing thread to one reading thread without either of them ever waiting.
+// The writer always has a buffer of its own to fill, the reader always has one of its own to read, and the third
+// one holds whatever was published last. Publishing and picking up a value only swap buffer indices, so a value the
+// reader never got around to reading is simply skipped.
+template <typename T>
+class TripleBuffer
+{
+public:
+	// Only before either thread starts using the buffers, e.g. to reserve their memory up front
+	template <typename Callback>
+	void ForEachBuffer(const Callback& callback)
+	{
+		for (T& buffer : buffers)
+		{
+			callback(buffer);
+		}
+	}
+
+	// Only the writing thread may call these
+	[[nodiscard]] T& GetWriteBuffer() { return buffers[writeIndex]; }
+
+	void Publish()
+	{
+		writeIndex = middleState.exchange(static_cast<uint8_t>(writeIndex | FRESH_BIT), std::memory_order_acq_rel) & INDEX_MASK;
+	}
+
+	// Only the reading thread may call this. Returns the same buffer as last time if nothing new was published,
+	// which is a default constructed T until the first value is published
+	[[nodiscard]] const T& GetLatest()
+	{
+		if (middleState.load(std::memory_order_relaxed) & FRESH_BIT)
+		{
+			readIndex = middleState.exchange(readIndex, std::memory_order_acq_rel) & INDEX_MASK;
+		}
+
+		return buffers[readIndex];
+	}
+
+private:
+	static constexpr uint8_t INDEX_MASK = 0b11;
+	static constexpr uint8_t FRESH_BIT = 0b100; // Set while the middle buffer holds a value the reader hasn't seen
+
+	std::array<T, 3> buffers = {};
+	uint8_t writeIndex = 0;
+	alignas(64) std::atomic<uint8_t> middleState = 1; // Kept apart from the indices the threads keep to themselves
+	alignas(64) uint8_t readIndex = 2;
+};
@@ -27,5 +27,14 @@ project (workspaceName)
 
 	includedirs { "./", "src", "include"}
 	link_raylib();
+
+	-- The images are compiled in from embedded_resources.h, which is generated from resources/ by a script.
+	-- The script checks that the header still matches the images before every build, and fails the build if it doesn't
+	prebuildmessage "Checking the embedded resources against resources/"
+	filter "system:windows"
+		prebuildcommands { "python \"%{wks.location}/tools/embed_resources.py\" --check" }
+	filter "system:not windows"
+		prebuildcommands { "python3 \"%{wks.location}/tools/embed_resources.py\" --check" }
+	filter {}
 	
 	-- To link to a lib use link_to("LIB_FOLDER_NAME")
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "allocation_tracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#if defined _WIN32
+#include <malloc.h>
+#endif
+
+#if defined DEBUG
+namespace
+{
+	std::atomic<size_t> allocationCount = 0;
+	thread_local int allowanceDepth = 0;
+}
+
+// The other forms of operator new and delete (array, nothrow, sized) forward to these by default,
+// the ones for over-aligned types (e.g. alignas(64) to keep threads off each other's cache lines) to the aligned ones
+void* operator new(const size_t size)
+{
+	if (allowanceDepth == 0)
+	{
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (void* memory = std::malloc(size == 0 ? 1 : size); memory != nullptr)
+	{
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+	if (allowanceDepth == 0)
+	{
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	const auto alignmentBytes = static_cast<size_t>(alignment);
+	const size_t sizeBytes = size == 0 ? 1 : size;
+#if defined _WIN32
+	void* memory = _aligned_malloc(sizeBytes, alignmentBytes);
+#else
+	// The size has to be a multiple of the alignment
+	void* memory = std::aligned_alloc(alignmentBytes, (sizeBytes + alignmentBytes - 1) / alignmentBytes * alignmentBytes);
+#endif
+	if (memory != nullptr)
+	{
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment)
+{
+	return operator new(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+#if defined _WIN32
+	_aligned_free(memory);
+#else
+	std::free(memory);
+#endif
+}
+
+void operator delete(void* memory, size_t, const std::align_val_t alignment) noexcept
+{
+	operator delete(memory, alignment);
+}
+
+void operator delete[](void* memory, const std::align_val_t alignment) noexcept
+{
+	operator delete(memory, alignment);
+}
+
+size_t AllocationTracker::GetAllocationCount()
+{
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+AllocationTracker::ScopedAllowance::ScopedAllowance()
+{
+	allowanceDepth++;
+}
+
+AllocationTracker::ScopedAllowance::~ScopedAllowance()
+{
+	allowanceDepth--;
+}
+#else
+size_t AllocationTracker::GetAllocationCount()
+{
+	return 0;
+}
+
+AllocationTracker::ScopedAllowance::ScopedAllowance() = default;
+AllocationTracker::ScopedAllowance::~ScopedAllowance() = default;
+#endif
@@ -1,7 +1,10 @@
 #include "i_observers.h"
 
 #include "board.h"
+#include "settings.h"
+#include "shared_board.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <random>
@@ -18,28 +21,42 @@
 
 Board::Board(const Vec2<int> screenPos,
              const int cellSize,
-             const int boardWidthCells,
-             const int boardHeightCells,
-             const int maxMinesAmount)
+             const size_t boardWidthCells,
+             const size_t boardHeightCells,
+             const uint64_t maxMinesAmount,
+             const bool autoChord)
 	: AGameObject(screenPos, cellSize),
 	  width(boardWidthCells),
 	  height(boardHeightCells),
-	  maxMinesOnBoard(maxMinesAmount)
+	  cellsAmount(boardWidthCells * boardHeightCells),
+	  maxMinesOnBoard(maxMinesAmount),
+	  minePlane(cellsAmount),
+	  openPlane(cellsAmount),
+	  flagPlane(cellsAmount),
+	  frontierPlane(cellsAmount),
+	  sessionArenaBuffer(std::make_unique_for_overwrite<std::byte[]>(GetSessionArenaSize(cellsAmount))),
+	  sessionArena(sessionArenaBuffer.get(), GetSessionArenaSize(cellsAmount), std::pmr::new_delete_resource()),
+	  isAutoChordEnabled(autoChord),
+	  tickChangedCells(cellsAmount)
 {
 	assert(width > 0 && height > 0 && "The board width or height cannot be smaller than 1");
+	assert(width <= SIZE_MAX / height && "The board has more cells than can be indexed");
+	assert(width <= UINT32_MAX && height <= UINT32_MAX && "The undo history can't hold rows or columns beyond 32 bits");
+	assert(maxMinesOnBoard <= cellsAmount && "The board cannot have more mines than cells");
 	assert(cellSizePixels > 0 && "The board cell size cannot be smaller than 1");
 
-	cellsLeftToReveal = width * height - maxMinesOnBoard;
-	cellsLeftToFlag = maxMinesOnBoard;
+	cellsLeftToReveal = cellsAmount - maxMinesOnBoard;
+	cellsLeftToFlag = static_cast<int64_t>(maxMinesOnBoard);
 
-	cells.reserve(static_cast<size_t>(width) * height);
-	for (int y = 0; y < height; ++y)
-	{
-		for (int x = 0; x < width; ++x)
-		{
-			cells.emplace_back(Vec2<int>(x, y));
-		}
-	}
+	// The events and the tick's changes outlive a reset, so they aren't part of the session arena
+	events.reserve(Event::TYPE_COUNT);
+	dispatchedEvents.reserve(Event::TYPE_COUNT);
+	transitions.reserve(BoardTickChanges::TRANSITION_COUNT);
+	tickTransitions.reserve(BoardTickChanges::TRANSITION_COUNT);
+	tickChangedWords.reserve(BitPlane::GetWordsAmount(cellsAmount));
+
+	ReserveSessionBuffers();
+	RebuildFrontier();
 }
 
 Board::~Board()
@@ -50,58 +67,220 @@ Board::~Board()
 	}
 }
 
+// The planes and the tick's change set are the only memory that grows with the board, everything else is
+// reserved up to a fixed size
+uint64_t Board::GetMemoryFootprint(const size_t& boardWidthCells, const size_t& boardHeightCells)
+{
+	const size_t boardCellsAmount = boardWidthCells * boardHeightCells;
+
+	return BitPlane::GetBytes(boardCellsAmount) * 5
+		+ BitPlane::GetWordsAmount(boardCellsAmount) * sizeof(size_t)
+		+ GetSessionArenaSize(boardCellsAmount);
+}
+
 void Board::Update()
 {
+	// The bots' moves are played before the mouse's, so the overlays end up showing where the mouse is
+	if (sharedBoard != nullptr)
+	{
+		PlaySharedMoves();
+	}
+
 	if (!IsCursorOnScreen())
 	{
 		return;
 	}
 
-	ResetCellsSpriteState();
+	ProcessMouseStates(InputQueue::GetInstance().GetMouseStates(), Vec2<int>{GetScreenWidth(), GetScreenHeight()});
+}
 
-	auto [mouseX, mouseY] = GetMousePosition();
-	const Vec2<int> mousePos =
-			Vec2<int>(static_cast<int>(mouseX), static_cast<int>(mouseY))
-			- screenPositionPixels;
+// Every button change since the last frame is handled in the order it happened in, on the cell it happened on.
+// The last state is the current one, so the overlays are left showing where the mouse is now
+void Board::ProcessMouseStates(const std::span<const MouseState> mouseStates, const Vec2<int>& screenSizePixels)
+{
+	// Cells that aren't drawn can't be clicked, which keeps a board that's larger than its layout from taking
+	// the clicks meant for whatever is drawn next to it
+	const Vec2<int> visibleCells = GetVisibleCellsAmount(screenSizePixels);
 
-	// Check if the mouse is within the board area
-	if (mousePos.x <= 0 || mousePos.x >= width * cellSizePixels
-		|| mousePos.y <= 0 || mousePos.y >= height * cellSizePixels)
+	for (const MouseState& mouseState : mouseStates)
 	{
-		return;
-	}
+		ClearCellOverlays();
 
-	const Vec2<int> selectedCellPos = GetCellPositionUnderMouse(mousePos);
-	Cell& newlySelectedCell = cells[selectedCellPos.y * width + selectedCellPos.x];
+		const Vec2<int> mousePos = mouseState.position - screenPositionPixels;
 
-	mouseSelectedCell = &newlySelectedCell;
+		// Check if the mouse is within the visible board area
+		if (mousePos.x <= 0 || mousePos.x / cellSizePixels >= visibleCells.x
+			|| mousePos.y <= 0 || mousePos.y / cellSizePixels >= visibleCells.y)
+		{
+			continue;
+		}
+
+		const Vec2<int> selectedCellPos = GetCellPositionUnderMouse(mousePos);
+		mouseSelectedCell = static_cast<size_t>(selectedCellPos.y) * width + static_cast<size_t>(selectedCellPos.x);
+
+		const size_t changesBefore = cellChanges.size();
+		ProcessInput(mouseState);
 
-	ProcessInput();
+		if (cellChanges.size() != changesBefore && changingInputTime == NO_INPUT_TIME)
+		{
+			changingInputTime = mouseState.time;
+		}
+	}
 }
 
 void Board::Draw() const
 {
-	for (const auto& cell : cells)
+	const BoardSprite::Outcome outcome = GetOutcome();
+	const ResourcesSingleton::ScaledAtlases& atlases = ResourcesSingleton::GetInstance().GetScaledAtlases(cellSizePixels);
+
+	// Boards can be far larger than the window, so only the cells that fit on the screen are drawn
+	const Vec2<int> visibleCells = GetVisibleCellsAmount();
+	for (int y = 0; y < visibleCells.y; ++y)
+	{
+		for (int x = 0; x < visibleCells.x; ++x)
+		{
+			DrawCell(static_cast<size_t>(y) * width + static_cast<size_t>(x), atlases, outcome, 0);
+		}
+	}
+
+	// Only a handful of cells are highlighted or pressed at a time, so they're drawn again on top,
+	// instead of checking every cell for them
+	const auto drawOverlay = [&atlases, outcome, this](const size_t cellIndex)
+	{
+		if (cellIndex != NO_CELL && this->IsCellVisible(cellIndex))
+		{
+			this->DrawCell(cellIndex, atlases, outcome, this->GetOverlayKey(cellIndex));
+		}
+	};
+	drawOverlay(highlightedCell);
+	drawOverlay(clickPreviewCell);
+	for (const size_t cellIndex : previewChordedCells)
+	{
+		drawOverlay(cellIndex);
+	}
+
+	// The hint is only relevant until the outlined cell is opened or flagged
+	if (hintedCellIndex != NO_HINT && IsUnknown(hintedCellIndex) && IsGameInProgress() && IsCellVisible(hintedCellIndex))
 	{
-		cell.Draw(
-			screenPositionPixels,
-			cellSizePixels,
-			IsGameWon(),
-			IsGameLost()
+		RaylibCpp::DrawRectangleLinesEx(
+			GetCellScreenPosition(hintedCellIndex),
+			Vec2<int>{cellSizePixels},
+			std::max(cellSizePixels / 16, 1),
+			Settings::HINT_OUTLINE_COLOR
 		);
 	}
 }
 
-void Board::Reset()
+// Only the visible cells are copied, so this costs as much as drawing them would
+void Board::CopyView(BoardView& view, const Vec2<int>& screenSizePixels) const
+{
+	view.screenPositionPixels = screenPositionPixels;
+	view.cellSizePixels = cellSizePixels;
+	view.visibleCells = GetVisibleCellsAmount(screenSizePixels);
+	view.outcome = GetOutcome();
+	view.isGameInProgress = IsGameInProgress();
+
+	const auto visibleWidth = static_cast<size_t>(view.visibleCells.x);
+	const size_t visibleCellsAmount = visibleWidth * static_cast<size_t>(view.visibleCells.y);
+	if (visibleCellsAmount > view.spriteKeys.capacity())
+	{
+		// Only a view that wasn't reserved, so it's reserved right away for however large the window gets
+		ReserveView(view);
+	}
+	view.spriteKeys.resize(visibleCellsAmount);
+
+	for (size_t y = 0; y < static_cast<size_t>(view.visibleCells.y); ++y)
+	{
+		for (size_t x = 0; x < visibleWidth; ++x)
+		{
+			view.spriteKeys[y * visibleWidth + x] = GetSpriteKey(y * width + x, 0);
+		}
+	}
+
+	const auto toViewIndex = [&view, visibleWidth, this](const size_t cellIndex)
+	{
+		const size_t x = cellIndex % this->width;
+		const size_t y = cellIndex / this->width;
+		return x < visibleWidth && y < static_cast<size_t>(view.visibleCells.y) ? y * visibleWidth + x : BoardView::NO_CELL;
+	};
+	const auto copyOverlay = [&view, &toViewIndex, this](const size_t cellIndex)
+	{
+		if (cellIndex == NO_CELL)
+		{
+			return;
+		}
+
+		if (const size_t viewIndex = toViewIndex(cellIndex); viewIndex != BoardView::NO_CELL)
+		{
+			view.spriteKeys[viewIndex] = this->GetSpriteKey(cellIndex, this->GetOverlayKey(cellIndex));
+		}
+	};
+	copyOverlay(highlightedCell);
+	copyOverlay(clickPreviewCell);
+	for (const size_t cellIndex : previewChordedCells)
+	{
+		copyOverlay(cellIndex);
+	}
+
+	const bool isHintShown = hintedCellIndex != NO_HINT && IsUnknown(hintedCellIndex) && IsGameInProgress();
+	view.hintedCell = isHintShown ? toViewIndex(hintedCellIndex) : BoardView::NO_CELL;
+}
+
+void BoardView::Draw() const
 {
-	for (Cell& cell : cells)
+	if (spriteKeys.empty())
+	{
+		return;
+	}
+
+	const ResourcesSingleton::ScaledAtlases& atlases = ResourcesSingleton::GetInstance().GetScaledAtlases(cellSizePixels);
+
+	for (int y = 0; y < visibleCells.y; ++y)
+	{
+		for (int x = 0; x < visibleCells.x; ++x)
+		{
+			const uint8_t spriteKey = spriteKeys[static_cast<size_t>(y) * static_cast<size_t>(visibleCells.x) + static_cast<size_t>(x)];
+
+			RaylibCpp::DrawTextureRec(
+				atlases.cellAtlasTexture,
+				atlases.GetSprite(BoardSprite::SPRITE_TABLE[outcome][spriteKey]),
+				screenPositionPixels + Vec2<int>{x, y} * cellSizePixels,
+				WHITE
+			);
+		}
+	}
+
+	if (hintedCell != NO_CELL)
 	{
-		cell.Reset();
+		const auto visibleWidth = static_cast<size_t>(visibleCells.x);
+		const Vec2<int> hintedCellPosition{static_cast<int>(hintedCell % visibleWidth), static_cast<int>(hintedCell / visibleWidth)};
+
+		RaylibCpp::DrawRectangleLinesEx(
+			screenPositionPixels + hintedCellPosition * cellSizePixels,
+			Vec2<int>{cellSizePixels},
+			std::max(cellSizePixels / 16, 1),
+			Settings::HINT_OUTLINE_COLOR
+		);
 	}
+}
+
+void Board::Reset()
+{
+	minePlane.ClearAll();
+	openPlane.ClearAll();
+	flagPlane.ClearAll();
+	explodedCellIndex = NO_CELL;
 
-	cellsLeftToReveal = width * height - maxMinesOnBoard;
-	cellsLeftToFlag = maxMinesOnBoard;
+	cellsLeftToReveal = cellsAmount - maxMinesOnBoard;
+	cellsLeftToFlag = static_cast<int64_t>(maxMinesOnBoard);
 	boardState = LAYOUT_UNINITIALIZED;
+	ClearActionHistory();
+	ReserveSessionBuffers();
+	RebuildFrontier();
+	hintedCellIndex = NO_HINT;
+
+	RecordTransition(BoardTickChanges::BOARD_CLEARED);
+	NotifyBoardClearedObservers();
 }
 
 void Board::Attach(IObserver* observer)
@@ -116,15 +295,116 @@ void Board::Detach(IObserver* observer)
 
 void Board::NotifyFlagToggleObservers()
 {
-	for (IObserver* observer : observers)
+	QueueEvent(Event{Event::FLAG_COUNT_CHANGED, cellsLeftToFlag});
+}
+
+void Board::EndTick()
+{
+	// A tick that didn't change any cells still ends with an empty change set
+	if (isTickChangeSetEnded)
+	{
+		ClearTickChanges();
+	}
+	GatherOverlayChanges();
+	isTickChangeSetEnded = true;
+
+	std::swap(tickTransitions, transitions);
+	transitions.clear();
+
+	// Bots that are in the middle of reading the planes don't have to start over because of an idle tick
+	if (sharedBoard != nullptr && (!tickChangedWords.empty() || !tickTransitions.empty()))
 	{
-		if (auto* specificObserver = dynamic_cast<IObserverFlagToggle*>(observer); specificObserver != nullptr)
+		const bool isWholeBoardChanged = std::ranges::any_of(tickTransitions, [](const BoardTickChanges::Transition transition)
 		{
-			specificObserver->OnToggledCellFlag(cellsLeftToFlag);
-		}
+			return transition == BoardTickChanges::BOARD_CLEARED || transition == BoardTickChanges::SNAPSHOT_LOADED;
+		});
+		PublishSharedState(isWholeBoardChanged);
+	}
+
+	DispatchEvents();
+	NotifyCellChangeObservers();
+}
+
+BoardSprite::Outcome Board::GetOutcome() const
+{
+	if (IsGameWon())
+	{
+		return BoardSprite::WON;
+	}
+	if (IsGameLost())
+	{
+		return BoardSprite::LOST;
+	}
+	return BoardSprite::IN_PROGRESS;
+}
+
+bool Board::PlayMove(const BoardMove& move)
+{
+	if (move.x >= width || move.y >= height || IsGameLost() || IsGameWon())
+	{
+		return false;
+	}
+
+	mouseSelectedCell = move.y * width + move.x;
+
+	switch (move.type)
+	{
+	case BoardMove::OPEN:
+		OpenSelectedCell();
+		break;
+	case BoardMove::FLAG:
+		FlagCell(mouseSelectedCell);
+		break;
+	case BoardMove::CHORD:
+		ChordSelectedCell();
+		break;
+	}
+
+	// Chording previews the cells around the chorded cell, which only means something under a mouse
+	ClearCellOverlays();
+
+	return true;
+}
+
+void Board::SetSeed(const uint32_t newSeed)
+{
+	seed = newSeed;
+	isSeedFixed = true;
+}
+
+bool Board::ShareState(const std::string& name)
+{
+	auto newSharedBoard = std::make_unique<SharedBoard>();
+	if (!newSharedBoard->Open(name, width, height))
+	{
+		return false;
+	}
+
+	sharedBoard = std::move(newSharedBoard);
+	PublishSharedState(true);
+
+	return true;
+}
+
+// Only as many moves as the ring holds are played in one go, so a bot that keeps the ring full can't keep the
+// board from ever finishing its tick
+void Board::PlaySharedMoves()
+{
+	BoardMove move{};
+	for (uint64_t i = 0; i < SharedMoveRing::CAPACITY && sharedBoard->TakeMove(move); ++i)
+	{
+		PlayMove(move);
 	}
 }
 
+double Board::TakeChangingInputTime()
+{
+	const double inputTime = changingInputTime;
+	changingInputTime = NO_INPUT_TIME;
+
+	return inputTime;
+}
+
 
 //	#####################
 //	# Private functions #
@@ -133,138 +413,190 @@ void Board::NotifyFlagToggleObservers()
 
 void Board::NotifyGameStartObservers()
 {
-	for (IObserver* observer : observers)
-	{
-		if (auto* specificObserver = dynamic_cast<IObserverGameStart*>(observer); specificObserver != nullptr)
-		{
-			specificObserver->OnGameStarted();
-		}
-	}
+	QueueEvent(Event{Event::GAME_STARTED});
 }
 
 void Board::NotifyBoardMouseButtonDownObservers()
 {
-	for (IObserver* observer : observers)
-	{
-		if (auto* specificObserver = dynamic_cast<IObserverBoardMouseButtonDown*>(observer); specificObserver != nullptr)
-		{
-			specificObserver->OnBoardMouseButtonDown();
-		}
-	}
+	QueueEvent(Event{Event::MOUSE_BUTTON_DOWN});
 }
 
 void Board::NotifyGameWonObservers()
 {
-	for (IObserver* observer : observers)
-	{
-		if (auto* specificObserver = dynamic_cast<IObserverGameWon*>(observer); specificObserver != nullptr)
-		{
-			specificObserver->OnGameWon();
-		}
-	}
+	QueueEvent(Event{Event::GAME_WON});
 }
 
 void Board::NotifyGameLostObservers()
 {
+	QueueEvent(Event{Event::GAME_LOST});
+}
+
+// Sent right away, like a full buffer of cell changes, so the changes that were sent before it never arrive after it.
+// The changes that haven't been sent yet were all undone by clearing the board
+void Board::NotifyBoardClearedObservers()
+{
+	cellChanges.clear();
+	NotifyObservers<IObserverCellChange>([](IObserverCellChange& observer) { observer.OnBoardCleared(); });
+}
+
+void Board::NotifyCellChangeObservers()
+{
+	if (cellChanges.empty())
+	{
+		return;
+	}
+
 	for (IObserver* observer : observers)
 	{
-		if (auto* specificObserver = dynamic_cast<IObserverGameLost*>(observer); specificObserver != nullptr)
+		if (auto* specificObserver = dynamic_cast<IObserverCellChange*>(observer); specificObserver != nullptr)
 		{
-			specificObserver->OnGameLost();
+			specificObserver->OnCellsChanged(cellChanges);
 		}
 	}
+
+	cellChanges.clear();
 }
 
-void Board::ResetCellsSpriteState() const
+// Only the latest flag count matters, and the face only needs to know that a button went down,
+// so those replace the one that's already queued, where it's queued. The observers only keep the outcome of the
+// latest game, so when the game starts or ends again, the event that's already queued moves to the end instead.
+// Either way, every type of event is queued at most once, so the queue never grows past the space it's reserved
+void Board::QueueEvent(const Event& event)
 {
-	// Resets old cell highlighting
-	if (mouseSelectedCell != nullptr)
+	const auto isSameType = [&event](const Event& queuedEvent) { return queuedEvent.type == event.type; };
+	if (event.type == Event::FLAG_COUNT_CHANGED || event.type == Event::MOUSE_BUTTON_DOWN)
 	{
-		mouseSelectedCell->Highlight(false);
+		if (const auto queuedEvent = std::ranges::find_if(events, isSameType); queuedEvent != events.end())
+		{
+			*queuedEvent = event;
+			return;
+		}
 	}
-
-	// Resets chorded cells preview
-	for (Cell* cell : previewChordedCells)
+	else
 	{
-		cell->SetPreviewingChord(false);
+		std::erase_if(events, isSameType);
 	}
 
-	// Resets cell click preview
-	if (mouseSelectedCell != nullptr
-		&& mouseSelectedCell->IsPreviewingClick())
+	assert(events.size() < events.capacity() && "Every type of event is only queued once");
+	events.push_back(event);
+}
+
+void Board::DispatchEvents()
+{
+	std::swap(events, dispatchedEvents);
+
+	for (const Event& event : dispatchedEvents)
 	{
-		mouseSelectedCell->SetPreviewingClick(false);
+		switch (event.type)
+		{
+		case Event::GAME_STARTED:
+			NotifyObservers<IObserverGameStart>([](IObserverGameStart& observer) { observer.OnGameStarted(); });
+			break;
+		case Event::FLAG_COUNT_CHANGED:
+			NotifyObservers<IObserverFlagToggle>([&event](IObserverFlagToggle& observer)
+			{
+				observer.OnToggledCellFlag(event.minesLeftToFlag);
+			});
+			break;
+		case Event::MOUSE_BUTTON_DOWN:
+			NotifyObservers<IObserverBoardMouseButtonDown>([](IObserverBoardMouseButtonDown& observer) { observer.OnBoardMouseButtonDown(); });
+			break;
+		case Event::GAME_WON:
+			NotifyObservers<IObserverGameWon>([](IObserverGameWon& observer) { observer.OnGameWon(); });
+			break;
+		case Event::GAME_LOST:
+			NotifyObservers<IObserverGameLost>([](IObserverGameLost& observer) { observer.OnGameLost(); });
+			break;
+		case Event::TYPE_COUNT:
+			assert(false && "Not an event type");
+			break;
+		}
 	}
+
+	dispatchedEvents.clear();
+}
+
+void Board::ClearCellOverlays()
+{
+	highlightedCell = NO_CELL;
+	clickPreviewCell = NO_CELL;
+	previewChordedCells.Clear();
 }
 
-void Board::ProcessInput()
+void Board::ProcessInput(const MouseState& mouseState)
 {
 	if (IsGameLost() || IsGameWon())
 	{
 		return;
 	}
 
-	mouseSelectedCell->Highlight(true);
+	if (!IsOpen(mouseSelectedCell))
+	{
+		highlightedCell = mouseSelectedCell;
+	}
 
 	// Chording
-	if (IsMouseButtonDown(RaylibCpp::MOUSE_LEFT_CLICK) && IsMouseButtonReleased(RaylibCpp::MOUSE_RIGHT_CLICK)
-		|| IsMouseButtonDown(RaylibCpp::MOUSE_RIGHT_CLICK) && IsMouseButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK)
-		|| IsMouseButtonReleased(RaylibCpp::MOUSE_MIDDLE_CLICK))
+	if ((mouseState.IsButtonDown(RaylibCpp::MOUSE_LEFT_CLICK) && mouseState.IsButtonReleased(RaylibCpp::MOUSE_RIGHT_CLICK))
+		|| (mouseState.IsButtonDown(RaylibCpp::MOUSE_RIGHT_CLICK) && mouseState.IsButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK))
+		|| mouseState.IsButtonReleased(RaylibCpp::MOUSE_MIDDLE_CLICK))
 	{
-		ChordClickedCell(true);
+		ChordSelectedCell();
 	}
 	// Preview chorded cells
-	else if (IsMouseButtonDown(RaylibCpp::MOUSE_LEFT_CLICK) && IsMouseButtonDown(RaylibCpp::MOUSE_RIGHT_CLICK)
-		|| IsMouseButtonDown(RaylibCpp::MOUSE_MIDDLE_CLICK))
+	else if ((mouseState.IsButtonDown(RaylibCpp::MOUSE_LEFT_CLICK) && mouseState.IsButtonDown(RaylibCpp::MOUSE_RIGHT_CLICK))
+		|| mouseState.IsButtonDown(RaylibCpp::MOUSE_MIDDLE_CLICK))
 	{
 		ChordClickedCell(false);
-		mouseSelectedCell->SetPreviewingClick(true);
+		clickPreviewCell = mouseSelectedCell;
 		NotifyBoardMouseButtonDownObservers();
 	}
 	// Revealing a cell
-	else if (IsMouseButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK))
+	else if (mouseState.IsButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK))
 	{
-		if (mouseSelectedCell->IsFlagged())
-		{
-			return;
-		}
-
-		if (boardState == LAYOUT_UNINITIALIZED)
-		{
-			GenerateBoardLayout();
-		}
-
-		OpenClickedCell(*mouseSelectedCell);
+		OpenSelectedCell();
 	}
 	// Preview click
-	else if (IsMouseButtonDown(RaylibCpp::MOUSE_LEFT_CLICK))
+	else if (mouseState.IsButtonDown(RaylibCpp::MOUSE_LEFT_CLICK))
 	{
-		if (mouseSelectedCell->IsFlagged())
+		if (IsFlagged(mouseSelectedCell))
 		{
 			return;
 		}
 
-		mouseSelectedCell->SetPreviewingClick(true);
+		clickPreviewCell = mouseSelectedCell;
 		NotifyBoardMouseButtonDownObservers();
 	}
 	// Flagging a cell
-	else if (IsMouseButtonReleased(RaylibCpp::MOUSE_RIGHT_CLICK))
+	else if (mouseState.IsButtonReleased(RaylibCpp::MOUSE_RIGHT_CLICK))
 	{
-		if (mouseSelectedCell->ToggleFlag())
-		{
-			cellsLeftToFlag--;
-		}
-		else
-		{
-			cellsLeftToFlag++;
-		}
+		FlagCell(mouseSelectedCell);
+	}
+}
 
-		NotifyFlagToggleObservers();
+void Board::OpenSelectedCell()
+{
+	if (IsFlagged(mouseSelectedCell))
+	{
+		return;
+	}
 
-#if defined DEBUG
-		std::cout << "Cells left to flag: " << cellsLeftToFlag << "\n";
-#endif
+	if (boardState == LAYOUT_UNINITIALIZED)
+	{
+		GenerateBoardLayout();
 	}
+
+	BeginAction();
+	OpenClickedCell(mouseSelectedCell);
+	AutoChord();
+	EndAction(OPEN_CELLS);
+}
+
+void Board::ChordSelectedCell()
+{
+	BeginAction();
+	ChordClickedCell(true);
+	AutoChord();
+	EndAction(OPEN_CELLS);
 }
 
 Vec2<int> Board::GetCellPositionUnderMouse(const Vec2<int>& mousePosPixels) const
@@ -274,23 +606,28 @@ Vec2<int> Board::GetCellPositionUnderMouse(const Vec2<int>& mousePosPixels) cons
 		mousePosPixels.y / cellSizePixels
 	};
 
-	assert(cellPos.x < width && cellPos.y < height && "Trying to access cell position out of bounds");
+	assert(static_cast<size_t>(cellPos.x) < width && static_cast<size_t>(cellPos.y) < height
+		&& "Trying to access cell position out of bounds");
 
 	return cellPos;
 }
 
-void Board::OpenClickedCell(Cell& currentCell)
+void Board::OpenClickedCell(const size_t& cellIndex)
 {
-	if (currentCell.HasMine())
+	if (HasMine(cellIndex))
 	{
-		currentCell.ExplodeMine();
+		// Chording around a wrong flag can open more than one mine, the first one is the one that lost the game
+		if (explodedCellIndex == NO_CELL)
+		{
+			explodedCellIndex = cellIndex;
+		}
 
 		LoseGame();
 
 		return;
 	}
 
-	const int cellsRevealed = currentCell.Reveal();
+	const uint64_t cellsRevealed = RevealCells(cellIndex);
 
 	cellsLeftToReveal -= cellsRevealed;
 
@@ -300,275 +637,1153 @@ void Board::OpenClickedCell(Cell& currentCell)
 	}
 }
 
-void Board::ChordClickedCell(const bool& openCells)
+bool Board::OpenCell(const size_t& cellIndex)
 {
-	// Check how many adjacent cells are flagged and preview the rest as chorded
-	int flaggedAdjacentCells = 0;
-	const CallbackOnAdjacentCells checkAdjacentFlaggedCells = [&flaggedAdjacentCells, this](Cell&, Cell& adjacentCell)
-	{
-		if (adjacentCell.IsFlagged())
-		{
-			flaggedAdjacentCells++;
-		}
-		else
-		{
-			adjacentCell.SetPreviewingChord(true);
-			this->previewChordedCells.push_back(&adjacentCell);
-		}
-	};
-	ProcessCellNeighbors(*mouseSelectedCell, checkAdjacentFlaggedCells);
-
-	// Exit function if previewing chord or chording action is invalid for this cell
-	if (!openCells
-		|| !mouseSelectedCell->IsOpen()
-		|| flaggedAdjacentCells == 0
-		|| flaggedAdjacentCells != mouseSelectedCell->GetAdjacentMinesAmount())
+	if (!CanOpen(cellIndex))
 	{
-		return;
+		return false;
 	}
 
-	// Open the adjacent cells
-	const CallbackOnAdjacentCells openAdjacentClosedCells = [this](Cell&, Cell& adjacentCell)
-	{
-		if (!adjacentCell.IsOpen()
-			&& !adjacentCell.IsFlagged())
-		{
-			this->OpenClickedCell(adjacentCell);
-		}
-	};
-	ProcessCellNeighbors(*mouseSelectedCell, openAdjacentClosedCells);
-}
-
-void Board::GenerateBoardLayout()
-{
-	std::vector<Vec2<int>> freeCellPositions = {};
-
-	// Simple case if the are no mines
-	if (maxMinesOnBoard == 0)
-	{
-		for (Cell& cell : cells)
-		{
-			// We still need to determine the adjacent cells to open up the entire board in one click
-			std::vector<Cell*> adjacentCells = {};
-			CallbackOnAdjacentCells getAdjacentCellsOnly = [&adjacentCells](Cell&, Cell& adjacentCell)
-			{
-				adjacentCells.push_back(&adjacentCell);
-			};
-			ProcessCellNeighbors(cell, getAdjacentCellsOnly);
+	openPlane.Set(cellIndex);
+	RecordCellChange(cellIndex, CellChange::OPENED);
+	RecordActionChange(cellIndex);
 
-			cell.Initialize(false, 0, adjacentCells);
-		}
-	}
-	// Simple case if every cell has a mine
-	else if (maxMinesOnBoard == static_cast<int>(cells.size()))
-	{
-		for (Cell& cell : cells)
-		{
-			cell.Initialize(true, 8, {});
-		}
-	}
-	// Normal case
-	else
+	// Only cells that were just opened get chorded automatically, the frontier update drops the ones that
+	// have nothing closed around them
+	if (isAutoChordEnabled && IsOpenNumbered(cellIndex) && !autoChordCandidates.Insert(cellIndex))
 	{
-		DetermineInitialFreeCellPositions(freeCellPositions);
-		PlaceMines(freeCellPositions);
-		InitializeNonMinedCells();
+		autoChordRefillPosition = 0;
 	}
+	UpdateFrontier(cellIndex, false);
 
-	boardState = IN_PROGRESS;
-	NotifyGameStartObservers();
+	return true;
 }
 
-void Board::DetermineInitialFreeCellPositions(std::vector<Vec2<int>>& freeCellPositions)
+// Flood fills from the given cell a row at a time. Every seed on the stack is a closed cell without mines around it,
+// which is widened into the whole run of such cells in its row. That run is opened along with the cells on both of its
+// ends and the cells above and below it, and every run of such cells above and below it gets a single seed, so the
+// stack holds a few seeds per row instead of every cell that's waiting to have its neighbors opened.
+// The stack never grows. A seed that doesn't fit is left for later, and once the stack runs empty, the seeds are found
+// again next to the empty cells the tick has opened, as many as fit at a time. Only a huge reveal on a huge board ever
+// gets that far, and it still only looks at the cells the tick has changed.
+// Returns how many cells were revealed.
+uint64_t Board::RevealCells(const size_t& startCellIndex)
 {
-	// Add the position of every cell on the board to the list of candidates for mines
-	freeCellPositions.reserve(cells.size());
-	for (const Cell& cell : cells)
+	if (!CanOpen(startCellIndex))
 	{
-		if (&cell != mouseSelectedCell)
-		{
-			freeCellPositions.push_back(cell.GetCellPosition());
-		}
+		return 0;
 	}
 
-	// Determine if we can reserve the initial adjacent cells,
-	// so that the initial area around the clicked cell would not contain any mines. If not, then exit the function.
-	int adjacentCellsAmount = 0;
-	const CallbackOnAdjacentCells getInitialAdjacentCellsAmount = [&adjacentCellsAmount](Cell&, const Cell&)
+	const auto isEmptyClosedCell = [this](const size_t cellIndex)
 	{
-		adjacentCellsAmount++;
+		return this->CanOpen(cellIndex) && this->CountAdjacentMines(cellIndex) == 0;
 	};
-	ProcessCellNeighbors(*mouseSelectedCell, getInitialAdjacentCellsAmount);
 
-	if (static_cast<int>(cells.size()) - adjacentCellsAmount < maxMinesOnBoard)
+	// Numbered cells are the edge of the revealed area
+	if (!isEmptyClosedCell(startCellIndex))
 	{
-		return;
+		return OpenCell(startCellIndex) ? 1 : 0;
 	}
 
-	// Remove the cells around the initial clicked cell from the candidates list
-	const CallbackOnAdjacentCells removeInitialAdjacentCells = [&freeCellPositions, this](Cell&, const Cell& adjacentCell)
+	// The seeds that were left out are the empty closed cells next to the empty cells the tick has opened.
+	// Finding them again stops once the stack is full, and carries on from there once it's run empty again
+	const auto refillStack = [&isEmptyClosedCell, this]()
 	{
-		const auto positionIterator = std::ranges::find(freeCellPositions,
-		                                                adjacentCell.GetCellPosition());
-		freeCellPositions.erase(positionIterator);
-	};
-	ProcessCellNeighbors(*mouseSelectedCell, removeInitialAdjacentCells);
-}
+		this->revealStackRefillPosition = this->ForEachTickChangedCellFrom(this->revealStackRefillPosition, [&isEmptyClosedCell, this](const size_t cellIndex)
+		{
+			if (!this->IsOpen(cellIndex) || this->CountAdjacentMines(cellIndex) != 0)
+			{
+				return true;
+			}
 
-void Board::PlaceMines(std::vector<Vec2<int>>& freeCellPositions)
-{
-	const uint32_t currentTime = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(
-		std::chrono::steady_clock::now().time_since_epoch()).count());
-	auto mersenne = std::mt19937(currentTime);
+			bool isStackFull = false;
+			const auto addSeed = [&isStackFull, &isEmptyClosedCell, this](const size_t adjacentIndex)
+			{
+				if (!isEmptyClosedCell(adjacentIndex))
+				{
+					return;
+				}
 
-	int minesPlaced = 0;
-	while (minesPlaced < maxMinesOnBoard)
-	{
-		std::uniform_int_distribution<int> distribution{0, static_cast<int>(freeCellPositions.size()) - 1};
-		const int randomIndex = distribution(mersenne);
-		const Vec2<int> randomCellPos = freeCellPositions[randomIndex];
+				isStackFull = isStackFull || this->revealStack.size() == this->revealStack.capacity();
+				if (!isStackFull)
+				{
+					this->revealStack.push_back(adjacentIndex);
+				}
+			};
+			this->ProcessCellNeighbors(cellIndex, addSeed);
 
-		Cell& randomCell = cells[randomCellPos.y * width + randomCellPos.x];
+			return !isStackFull;
+		});
+	};
 
-		std::vector<Cell*> adjacentCells = {};
-		CallbackOnAdjacentCells getMineAdjacentCells = [&adjacentCells](Cell&, Cell& adjacentCell)
-		{
-			adjacentCells.push_back(&adjacentCell);
-		};
-		ProcessCellNeighbors(randomCell, getMineAdjacentCells);
+	uint64_t cellsRevealed = 0;
+	revealStack.push_back(startCellIndex);
 
-		// If a cell is already surrounded by mines and there is space to put the mine somewhere else,
-		// then remove that cell from the candidates list, so that we can have an 8 cell there instead
-		if (randomCell.GetAdjacentMinesAmount() == adjacentCells.size() && minesPlaced != static_cast<int>(freeCellPositions.size()))
+	while (!revealStack.empty() || revealStackRefillPosition != NO_REFILL)
+	{
+		if (revealStack.empty())
 		{
+			refillStack();
+			continue;
+		}
+
+		const size_t seedIndex = revealStack.back();
+		revealStack.pop_back();
+
+		// Another run can have reached the seed since it was pushed, in which case it opened the whole run
+		if (IsOpen(seedIndex))
+		{
+			continue;
+		}
+
+		const size_t rowStart = seedIndex - seedIndex % width;
+		size_t runFirst = seedIndex;
+		size_t runLast = seedIndex;
+		while (runFirst > rowStart && isEmptyClosedCell(runFirst - 1))
+		{
+			runFirst--;
+		}
+		while (runLast + 1 < rowStart + width && isEmptyClosedCell(runLast + 1))
+		{
+			runLast++;
+		}
+
+		const size_t spanFirstX = runFirst - rowStart - (runFirst > rowStart ? 1 : 0);
+		const size_t spanLastX = runLast - rowStart + (runLast + 1 < rowStart + width ? 1 : 0);
+
+		for (size_t x = spanFirstX; x <= spanLastX; ++x)
+		{
+			cellsRevealed += OpenCell(rowStart + x);
+		}
+
+		const auto visitAdjacentRow = [&cellsRevealed, &isEmptyClosedCell, spanFirstX, spanLastX, this](const size_t adjacentRowStart)
+		{
+			bool isInRun = false;
+			for (size_t x = spanFirstX; x <= spanLastX; ++x)
+			{
+				const size_t cellIndex = adjacentRowStart + x;
+				const bool isEmpty = isEmptyClosedCell(cellIndex);
+
+				if (isEmpty && !isInRun)
+				{
+					if (this->revealStack.size() < this->revealStack.capacity())
+					{
+						this->revealStack.push_back(cellIndex);
+					}
+					else
+					{
+						// Anything the tick opened before can be next to a seed that's been left out now
+						this->revealStackRefillPosition = 0;
+					}
+				}
+				else if (!isEmpty)
+				{
+					cellsRevealed += this->OpenCell(cellIndex);
+				}
+
+				isInRun = isEmpty;
+			}
+		};
+
+		if (rowStart > 0)
+		{
+			visitAdjacentRow(rowStart - width);
+		}
+		if (rowStart + width < cellsAmount)
+		{
+			visitAdjacentRow(rowStart + width);
+		}
+	}
+
+	return cellsRevealed;
+}
+
+void Board::ChordClickedCell(const bool& openCells)
+{
+	// Check how many adjacent cells are flagged and preview the rest as chorded
+	int flaggedAdjacentCells = 0;
+	const auto checkAdjacentFlaggedCells = [&flaggedAdjacentCells, this](const size_t adjacentIndex)
+	{
+		if (this->IsFlagged(adjacentIndex))
+		{
+			flaggedAdjacentCells++;
 		}
-		// Normal case
 		else
 		{
-			randomCell.Initialize(true, 0, adjacentCells); // We don't care how many mines are adjacent, since this cell has a mine
-			minesPlaced++;
+			this->previewChordedCells.Add(adjacentIndex);
+		}
+	};
+	ProcessCellNeighbors(mouseSelectedCell, checkAdjacentFlaggedCells);
+
+	// Exit function if previewing chord or chording action is invalid for this cell
+	if (!openCells
+		|| !IsOpen(mouseSelectedCell)
+		|| flaggedAdjacentCells == 0
+		|| flaggedAdjacentCells != GetAdjacentMinesAmount(mouseSelectedCell))
+	{
+		return;
+	}
+
+	// Open the adjacent cells
+	const auto openAdjacentClosedCells = [this](const size_t adjacentIndex)
+	{
+		if (this->IsUnknown(adjacentIndex))
+		{
+			this->OpenClickedCell(adjacentIndex);
+		}
+	};
+	ProcessCellNeighbors(mouseSelectedCell, openAdjacentClosedCells);
+}
+
+void Board::FlagCell(const size_t& cellIndex)
+{
+	// Open cells can't be flagged, so they shouldn't change the flag count either
+	if (IsOpen(cellIndex))
+	{
+		return;
+	}
+
+	BeginAction();
+	RecordActionChange(cellIndex);
+	EndAction(TOGGLE_FLAG);
+
+	ToggleCellFlag(cellIndex);
+
+	NotifyFlagToggleObservers();
+
+#if defined DEBUG
+	std::cout << "Cells left to flag: " << cellsLeftToFlag << "\n";
+#endif
+
+	// A new flag never chords anything by itself, a wrong one would open a mine before the player could undo it
+}
+
+void Board::ToggleCellFlag(const size_t& cellIndex)
+{
+	assert(!IsOpen(cellIndex) && "Open cells can't be flagged");
+
+	const bool isFlagged = !flagPlane.Test(cellIndex);
+	flagPlane.Assign(cellIndex, isFlagged);
+
+	cellsLeftToFlag += isFlagged ? -1 : 1;
+	RecordCellChange(cellIndex, isFlagged ? CellChange::FLAGGED : CellChange::UNFLAGGED);
+	UpdateFrontier(cellIndex, false);
+}
+
+// Chords candidates until none are left. A candidate is only added when one of its neighbors changes,
+// so this stays linear in the amount of cells the action ends up changing, however large the board is.
+// The candidates never grow past what they're reserved. Like the reveal's seeds, the ones that didn't fit are found
+// again among the cells the tick has changed, which has every cell that could have been added
+void Board::AutoChord()
+{
+	while (IsGameInProgress())
+	{
+		if (autoChordCandidates.IsEmpty())
+		{
+			if (autoChordRefillPosition == NO_REFILL)
+			{
+				break;
+			}
+
+			autoChordRefillPosition = ForEachTickChangedCellFrom(autoChordRefillPosition, [this](const size_t cellIndex)
+			{
+				return !this->IsOpenNumbered(cellIndex) || !this->frontierPlane.Test(cellIndex) || this->autoChordCandidates.Insert(cellIndex);
+			});
+			continue;
+		}
+
+		const size_t candidateIndex = autoChordCandidates.GetIndices().back();
+		autoChordCandidates.Erase(candidateIndex);
+
+		int flaggedAdjacentCells = 0;
+		const auto countAdjacentFlags = [&flaggedAdjacentCells, this](const size_t adjacentIndex)
+		{
+			flaggedAdjacentCells += this->IsFlagged(adjacentIndex);
+		};
+		ProcessCellNeighbors(candidateIndex, countAdjacentFlags);
+
+		// Same rule as chording by hand
+		if (flaggedAdjacentCells != GetAdjacentMinesAmount(candidateIndex))
+		{
+			continue;
+		}
+
+		// Opening a cell can end the game, so check before every cell
+		const auto openAdjacentClosedCells = [this](const size_t adjacentIndex)
+		{
+			if (this->IsUnknown(adjacentIndex) && this->IsGameInProgress())
+			{
+				this->OpenClickedCell(adjacentIndex);
+			}
+		};
+		ProcessCellNeighbors(candidateIndex, openAdjacentClosedCells);
+	}
+
+	autoChordCandidates.Clear();
+	autoChordRefillPosition = NO_REFILL;
+}
+
+void Board::GenerateBoardLayout()
+{
+	// Simple case if every cell has a mine
+	if (maxMinesOnBoard == cellsAmount)
+	{
+		minePlane.SetAll();
+	}
+	// Normal case, boards without mines have nothing to place
+	else if (maxMinesOnBoard > 0)
+	{
+		PlaceMines();
+	}
+
+	boardState = IN_PROGRESS;
+	RecordTransition(BoardTickChanges::GAME_STARTED);
+	NotifyGameStartObservers();
+}
+
+// Picks random cells until enough of them have a mine, which needs no list of candidates, so it takes no memory
+// beyond the mine plane itself. Picking a cell that is already taken is retried, so when more than half of the
+// free cells get a mine, every free cell gets one first, and random mines are taken away again instead.
+void Board::PlaceMines()
+{
+	if (!isSeedFixed)
+	{
+		seed = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+	auto mersenne = std::mt19937_64(seed); // Indices can go beyond 32 bits, which would take two draws each from the 32 bit generator
+
+	// The area around the initial clicked cell shouldn't contain any mines, if there's room for them elsewhere
+	size_t adjacentCellsAmount = 0;
+	const auto getInitialAdjacentCellsAmount = [&adjacentCellsAmount](const size_t)
+	{
+		adjacentCellsAmount++;
+	};
+	ProcessCellNeighbors(mouseSelectedCell, getInitialAdjacentCellsAmount);
+
+	const bool isAreaReserved = cellsAmount - 1 - adjacentCellsAmount >= maxMinesOnBoard;
+	const size_t freeCellsAmount = cellsAmount - 1 - (isAreaReserved ? adjacentCellsAmount : 0);
+
+	const size_t clickedIndex = mouseSelectedCell;
+	const size_t clickedX = clickedIndex % width;
+	const size_t clickedY = clickedIndex / width;
+	const auto isCellFree = [clickedIndex, clickedX, clickedY, isAreaReserved, this](const size_t& cellIndex)
+	{
+		if (!isAreaReserved)
+		{
+			return cellIndex != clickedIndex;
+		}
+
+		const size_t x = cellIndex % this->width;
+		const size_t y = cellIndex / this->width;
+		return x + 1 < clickedX || x > clickedX + 1 || y + 1 < clickedY || y > clickedY + 1;
+	};
+
+	const bool isPlacingMines = maxMinesOnBoard <= freeCellsAmount / 2;
+	if (!isPlacingMines)
+	{
+		for (size_t i = 0; i < cellsAmount; ++i)
+		{
+			if (isCellFree(i))
+			{
+				minePlane.Set(i);
+			}
+		}
+	}
+
+	std::uniform_int_distribution<size_t> distribution{0, cellsAmount - 1};
+	uint64_t cellsLeftToChange = isPlacingMines ? maxMinesOnBoard : freeCellsAmount - maxMinesOnBoard;
+	while (cellsLeftToChange > 0)
+	{
+		const size_t randomIndex = distribution(mersenne);
+
+		if (!isCellFree(randomIndex) || HasMine(randomIndex) == isPlacingMines)
+		{
+			continue;
 		}
 
-		freeCellPositions.erase(freeCellPositions.begin() + randomIndex);
+		minePlane.Assign(randomIndex, isPlacingMines);
+		cellsLeftToChange--;
 	}
 }
 
-void Board::InitializeNonMinedCells()
+// A closed cell is a mine for certain if it's next to a number that has no other closed cells around it to account for
+bool Board::IsProvenMine(const size_t& cellIndex) const
+{
+	bool isProvenMine = false;
+	const auto inspectAdjacentNumber = [this, &isProvenMine](const size_t adjacentIndex)
+	{
+		if (isProvenMine || !this->IsOpen(adjacentIndex))
+		{
+			return;
+		}
+
+		const uint8_t adjacentMines = this->CountAdjacentMines(adjacentIndex);
+		if (adjacentMines == 0)
+		{
+			return;
+		}
+
+		int closedCellsAroundNumber = 0;
+		const auto countClosedCell = [&closedCellsAroundNumber, this](const size_t indexAroundNumber)
+		{
+			closedCellsAroundNumber += !this->IsOpen(indexAroundNumber);
+		};
+		this->ProcessCellNeighbors(adjacentIndex, countClosedCell);
+
+		isProvenMine = closedCellsAroundNumber == adjacentMines;
+	};
+	ProcessCellNeighbors(cellIndex, inspectAdjacentNumber);
+
+	return isProvenMine;
+}
+
+// The dirty constraints are the open cells whose flag bit is set, which are found a word at a time
+bool Board::ShowHint()
 {
-	for (Cell& cell : cells)
+	if (!IsGameInProgress())
+	{
+		return false;
+	}
+
+	MarkConstraintsDirty();
+
+	const std::span<const uint64_t> openWords = openPlane.GetWords();
+	const std::span<const uint64_t> flagWords = flagPlane.GetWords();
+
+	for (size_t wordIndex = firstDirtyConstraint / 64; wordIndex < openWords.size(); ++wordIndex)
 	{
-		if (!cell.HasMine())
+		for (uint64_t dirtyBits = openWords[wordIndex] & flagWords[wordIndex]; dirtyBits != 0; dirtyBits &= dirtyBits - 1)
 		{
-			std::vector<Cell*> adjacentCells = {};
-			uint8_t adjacentMines = 0;
-			CallbackOnAdjacentCells getNormalCellAdjacentCellsData = [&adjacentCells, &adjacentMines](Cell&, Cell& adjacentCell)
+			const size_t constraintIndex = wordIndex * 64 + static_cast<size_t>(std::countr_zero(dirtyBits));
+			const uint8_t adjacentMines = CountAdjacentMines(constraintIndex);
+
+			// The player's flags aren't trusted, a wrong one would lead to a wrong hint. Only the numbers are used,
+			// flagging a cell just makes the cells around it get checked again
+			int closedAdjacentCells = 0;
+			size_t unknownAdjacentCell = NO_CELL;
+			const auto inspectAdjacentCell = [&closedAdjacentCells, &unknownAdjacentCell, this](const size_t adjacentIndex)
+			{
+				closedAdjacentCells += !this->IsOpen(adjacentIndex);
+				if (this->IsUnknown(adjacentIndex))
+				{
+					unknownAdjacentCell = adjacentIndex;
+				}
+			};
+			ProcessCellNeighbors(constraintIndex, inspectAdjacentCell);
+
+			firstDirtyConstraint = constraintIndex;
+
+			// There are exactly as many closed cells around this cell as there are mines around it
+			if (unknownAdjacentCell != NO_CELL && closedAdjacentCells == adjacentMines)
+			{
+				FlagCell(unknownAdjacentCell);
+				return true;
+			}
+
+			// Every mine around this cell is proven by the numbers next to it, so the rest are safe.
+			// The cell stays dirty, so asking again gives the same hint without searching
+			int provenAdjacentMines = 0;
+			size_t safeAdjacentCell = NO_CELL;
+			const auto proveAdjacentCell = [this, &provenAdjacentMines, &safeAdjacentCell](const size_t adjacentIndex)
 			{
-				adjacentCells.push_back(&adjacentCell);
-				if (adjacentCell.HasMine())
+				if (this->IsOpen(adjacentIndex))
+				{
+					return;
+				}
+
+				if (this->IsProvenMine(adjacentIndex))
+				{
+					provenAdjacentMines++;
+				}
+				else if (this->IsUnknown(adjacentIndex))
 				{
-					adjacentMines++;
+					safeAdjacentCell = adjacentIndex;
 				}
 			};
-			ProcessCellNeighbors(cell, getNormalCellAdjacentCellsData);
+			ProcessCellNeighbors(constraintIndex, proveAdjacentCell);
+
+			if (safeAdjacentCell != NO_CELL && provenAdjacentMines == adjacentMines)
+			{
+				hintedCellIndex = safeAdjacentCell;
+				return true;
+			}
+
+			flagPlane.Clear(constraintIndex);
+		}
+	}
+
+	firstDirtyConstraint = cellsAmount;
+
+#if defined DEBUG
+	std::cout << "No hint available\n";
+#endif
+
+	return false;
+}
+
+void Board::Undo()
+{
+	if (!IsGameInProgress() || actionsApplied == 0)
+	{
+		return;
+	}
+
+	actionsApplied--;
+	const Action& action = actionHistory[actionsApplied];
+
+	for (size_t i = GetActionChangesBegin(actionsApplied); i < action.changesEnd; ++i)
+	{
+		const size_t firstCellIndex = static_cast<size_t>(actionChanges[i].row) * width + actionChanges[i].firstX;
+
+		for (size_t cellIndex = firstCellIndex; cellIndex < firstCellIndex + actionChanges[i].cellsAmount; ++cellIndex)
+		{
+			if (action.type == OPEN_CELLS)
+			{
+				// The flag bit of an open cell only marks its constraint as dirty, a closed cell would take it for a flag
+				openPlane.Clear(cellIndex);
+				flagPlane.Clear(cellIndex);
+				cellsLeftToReveal++;
+				RecordCellChange(cellIndex, CellChange::CLOSED);
+				UpdateFrontier(cellIndex, true);
+			}
+			else
+			{
+				ToggleCellFlag(cellIndex);
+			}
+		}
+	}
+
+	// The player chose to go back to this state, so it shouldn't get chorded away by the next action
+	autoChordCandidates.Clear();
+	autoChordRefillPosition = NO_REFILL;
+
+	if (action.type == TOGGLE_FLAG)
+	{
+		NotifyFlagToggleObservers();
+	}
+}
+
+void Board::Redo()
+{
+	if (!IsGameInProgress() || actionsApplied == actionHistory.size())
+	{
+		return;
+	}
+
+	const Action& action = actionHistory[actionsApplied];
+
+	for (size_t i = GetActionChangesBegin(actionsApplied); i < action.changesEnd; ++i)
+	{
+		const size_t firstCellIndex = static_cast<size_t>(actionChanges[i].row) * width + actionChanges[i].firstX;
+
+		for (size_t cellIndex = firstCellIndex; cellIndex < firstCellIndex + actionChanges[i].cellsAmount; ++cellIndex)
+		{
+			if (action.type == OPEN_CELLS)
+			{
+				[[maybe_unused]] const bool isOpened = OpenCell(cellIndex);
+				assert(isOpened && "Redoing an action should only open closed cells");
+				cellsLeftToReveal--;
+			}
+			else
+			{
+				ToggleCellFlag(cellIndex);
+			}
+		}
+	}
+
+	actionsApplied++;
+	autoChordCandidates.Clear();
+	autoChordRefillPosition = NO_REFILL;
+
+	if (action.type == TOGGLE_FLAG)
+	{
+		NotifyFlagToggleObservers();
+	}
+	else if (cellsLeftToReveal == 0)
+	{
+		WinGame();
+	}
+}
+
+// A cell that changes the same way right before or after the last change only extends it, so a reveal takes a change
+// for every run of cells it opens in a row. The observers only count what changed, without looking at the board,
+// so once the buffer is full it's sent to them right away, instead of growing until the tick ends
+void Board::RecordCellChange(const size_t& cellIndex, const CellChange::Type& type)
+{
+	MarkTickChangedCell(cellIndex);
 
-			cell.Initialize(false, adjacentMines, adjacentCells);
+	if (!cellChanges.empty() && cellChanges.back().type == type)
+	{
+		CellChange& lastChange = cellChanges.back();
+		if (cellIndex == lastChange.firstCellIndex + lastChange.cellsAmount)
+		{
+			lastChange.cellsAmount++;
+			return;
+		}
+
+		if (cellIndex + 1 == lastChange.firstCellIndex)
+		{
+			lastChange.firstCellIndex--;
+			lastChange.cellsAmount++;
+			return;
+		}
+	}
+
+	RecordCellRun(cellIndex, 1, type);
+}
+
+void Board::RecordCellRun(const size_t& firstCellIndex, const size_t& cellsAmount, const CellChange::Type& type)
+{
+	if (cellChanges.size() == CELL_CHANGES_CAPACITY)
+	{
+		NotifyCellChangeObservers();
+	}
+
+	cellChanges.push_back(CellChange{firstCellIndex, cellsAmount, type});
+}
+
+// For when every cell is replaced at once, like by loading a game. Every cell is marked as changed a word at a time,
+// and the observers get the board cleared, followed by a run for every stretch of open or flagged cells.
+// The flag plane can't have any bits on open cells yet, so this has to come before the frontier is rebuilt
+void Board::RecordWholeBoardChange()
+{
+	NotifyBoardClearedObservers();
+
+	if (isTickChangeSetEnded)
+	{
+		ClearTickChanges();
+	}
+
+	const std::span<uint64_t> changedWords = tickChangedCells.GetWords();
+	for (size_t wordIndex = 0; wordIndex < changedWords.size(); ++wordIndex)
+	{
+		if (changedWords[wordIndex] == 0)
+		{
+			tickChangedWords.push_back(wordIndex);
+		}
+	}
+	tickChangedCells.SetAll();
+
+	openPlane.ForEachRun([this](const size_t firstCellIndex, const size_t cellsAmount)
+	{
+		this->RecordCellRun(firstCellIndex, cellsAmount, CellChange::OPENED);
+	});
+	flagPlane.ForEachRun([this](const size_t firstCellIndex, const size_t cellsAmount)
+	{
+		this->RecordCellRun(firstCellIndex, cellsAmount, CellChange::FLAGGED);
+	});
+}
+
+void Board::MarkTickChangedCell(const size_t& cellIndex)
+{
+	if (isTickChangeSetEnded)
+	{
+		ClearTickChanges();
+	}
+
+	const size_t wordIndex = cellIndex / 64;
+	if (tickChangedCells.GetWords()[wordIndex] == 0)
+	{
+		tickChangedWords.push_back(wordIndex);
+	}
+
+	tickChangedCells.Set(cellIndex);
+}
+
+// Only clears the words that have changed cells, so it takes as long as the tick's changes did
+void Board::ClearTickChanges()
+{
+	const std::span<uint64_t> words = tickChangedCells.GetWords();
+	for (const size_t wordIndex : tickChangedWords)
+	{
+		words[wordIndex] = 0;
+	}
+
+	tickChangedWords.clear();
+	isTickChangeSetEnded = false;
+}
+
+// A tick hardly ever has more than a couple. Restarting the game over and over within a single frame would keep adding
+// them, but only the latest of each tells what the board ended up as, so like the events, a repeated transition
+// moves to the end and the list never grows past the space it's reserved
+void Board::RecordTransition(const BoardTickChanges::Transition& transition)
+{
+	std::erase(transitions, transition);
+
+	assert(transitions.size() < transitions.capacity() && "Every transition is only recorded once per tick");
+	transitions.push_back(transition);
+}
+
+// The overlays are set again for every mouse state, so instead of following every change to them,
+// the few cells they covered when the last tick ended are compared with the ones they cover now
+void Board::GatherOverlayChanges()
+{
+	const std::array<OverlaidCell, MAX_OVERLAID_CELLS> previousOverlaidCells = overlaidCells;
+	const std::span<const OverlaidCell> previous(previousOverlaidCells.data(), overlaidCellsAmount);
+
+	for (const auto& [cellIndex, spriteKey] : previous)
+	{
+		if (GetSpriteKey(cellIndex, GetOverlayKey(cellIndex)) != spriteKey)
+		{
+			MarkTickChangedCell(cellIndex);
+		}
+	}
+
+	overlaidCellsAmount = 0;
+	const auto addOverlaidCell = [&previous, this](const size_t cellIndex)
+	{
+		if (cellIndex == NO_CELL)
+		{
+			return;
+		}
+
+		const uint8_t spriteKey = this->GetSpriteKey(cellIndex, this->GetOverlayKey(cellIndex));
+		const auto hasCell = [cellIndex](const OverlaidCell& overlaidCell) { return overlaidCell.cellIndex == cellIndex; };
+
+		// Open cells look the same with or without an overlay
+		const std::span<const OverlaidCell> current(this->overlaidCells.data(), this->overlaidCellsAmount);
+		if (spriteKey == this->GetSpriteKey(cellIndex, 0) || std::ranges::any_of(current, hasCell))
+		{
+			return;
+		}
+
+		assert(this->overlaidCellsAmount < MAX_OVERLAID_CELLS && "More cells are overlaid than the mouse can cover");
+		this->overlaidCells[this->overlaidCellsAmount++] = OverlaidCell{cellIndex, spriteKey};
+
+		if (!std::ranges::any_of(previous, hasCell))
+		{
+			this->MarkTickChangedCell(cellIndex);
+		}
+	};
+	addOverlaidCell(highlightedCell);
+	addOverlaidCell(clickPreviewCell);
+	for (const size_t cellIndex : previewChordedCells)
+	{
+		addOverlaidCell(cellIndex);
+	}
+}
+
+// Copies the board into the shared segment for bots, inside a single write so they never see half of a tick.
+// Every cell is written when the whole board changed at once, otherwise only the cells that changed during the tick
+void Board::PublishSharedState(const bool& isWholeBoardChanged)
+{
+	sharedBoard->BeginWrite();
+
+	if (isWholeBoardChanged)
+	{
+		for (size_t cellIndex = 0; cellIndex < cellsAmount; ++cellIndex)
+		{
+			sharedBoard->WriteCell(cellIndex, GetSpriteKey(cellIndex, 0));
+		}
+	}
+	else
+	{
+		GetTickChanges().ForEachChangedCell([this](const size_t cellIndex)
+		{
+			this->sharedBoard->WriteCell(cellIndex, this->GetSpriteKey(cellIndex, 0));
+		});
+	}
+
+	SharedBoardHeader::State state = SharedBoardHeader::READY;
+	if (IsGameWon())
+	{
+		state = SharedBoardHeader::WON;
+	}
+	else if (IsGameLost())
+	{
+		state = SharedBoardHeader::LOST;
+	}
+	else if (IsGameInProgress())
+	{
+		state = SharedBoardHeader::PLAYING;
+	}
+
+	sharedBoard->EndWrite(state, cellsLeftToFlag);
+}
+
+// Called after a cell was opened, closed or (un)flagged. Only the cell and its neighbors can enter or leave
+// the frontier. Which of the neighbors have to be checked again depends on what happened to the cell, so the cells
+// a huge reveal opens mostly get away with looking at their neighbors, instead of counting the mines around each
+void Board::UpdateFrontier(const size_t& changedCellIndex, const bool& wasOpen)
+{
+	const bool isOpen = IsOpen(changedCellIndex);
+	const bool isUnknown = IsUnknown(changedCellIndex);
+
+	// Mines never move during a game, so a cell that was just closed still has the number it was opened with
+	const bool isNumbered = (isOpen || wasOpen) && CountAdjacentMines(changedCellIndex) > 0;
+
+	const auto updateAdjacentCell = [isOpen, isUnknown, isNumbered, this](const size_t adjacentIndex)
+	{
+		if (this->IsOpen(adjacentIndex))
+		{
+			// An open cell can only join the open frontier when the cell became unknown, and leave it otherwise
+			if (isUnknown || this->frontierPlane.Test(adjacentIndex))
+			{
+				this->UpdateFrontierMembership(adjacentIndex);
+			}
+		}
+		else if (isNumbered && this->IsUnknown(adjacentIndex))
+		{
+			// An open number keeps every unknown cell around it on the closed frontier, a closed one might not have
+			if (isOpen)
+			{
+				this->frontierPlane.Set(adjacentIndex);
+			}
+			else if (this->frontierPlane.Test(adjacentIndex))
+			{
+				this->UpdateFrontierMembership(adjacentIndex);
+			}
+		}
+	};
+	ProcessCellNeighbors(changedCellIndex, updateAdjacentCell);
+
+	UpdateFrontierMembership(changedCellIndex);
+
+	if (isOpen != wasOpen)
+	{
+		const size_t cellX = changedCellIndex % width;
+		const size_t cellY = changedCellIndex / width;
+		openChangedArea.firstX = std::min(openChangedArea.firstX, cellX);
+		openChangedArea.firstY = std::min(openChangedArea.firstY, cellY);
+		openChangedArea.lastX = std::max(openChangedArea.lastX, cellX);
+		openChangedArea.lastY = std::max(openChangedArea.lastY, cellY);
+	}
+}
+
+// Nothing is counted ahead of time, since that would cost memory for every cell, so this looks at the neighbors
+void Board::UpdateFrontierMembership(const size_t& cellIndex)
+{
+	if (!IsOpen(cellIndex))
+	{
+		frontierPlane.Assign(cellIndex, !flagPlane.Test(cellIndex) && HasOpenNumberedNeighbor(cellIndex));
+		return;
+	}
+
+	const bool isOnFrontier = HasUnknownNeighbor(cellIndex) && CountAdjacentMines(cellIndex) > 0;
+	frontierPlane.Assign(cellIndex, isOnFrontier);
+
+	// Everything that reaches this has had its surroundings changed, so the hint solver has to look at it again
+	flagPlane.Assign(cellIndex, isOnFrontier);
+	if (isOnFrontier)
+	{
+		firstDirtyConstraint = std::min(firstDirtyConstraint, cellIndex);
+	}
+	else if (isAutoChordEnabled)
+	{
+		autoChordCandidates.Erase(cellIndex);
+	}
+}
+
+// The hint solver counts the closed cells around the numbers next to a constraint's closed cells, so opening or
+// closing a cell changes what the constraints up to three cells away can prove. Instead of marking them for every cell
+// that changes, which would add up over a huge reveal, every open frontier cell in the rectangle around all of them
+// is marked at once, a word of each row at a time
+void Board::MarkConstraintsDirty()
+{
+	if (openChangedArea.firstX > openChangedArea.lastX)
+	{
+		return;
+	}
+
+	constexpr size_t RADIUS = 3;
+	const size_t firstX = openChangedArea.firstX - std::min(openChangedArea.firstX, RADIUS);
+	const size_t lastX = std::min(openChangedArea.lastX + RADIUS, width - 1);
+	const size_t firstY = openChangedArea.firstY - std::min(openChangedArea.firstY, RADIUS);
+	const size_t lastY = std::min(openChangedArea.lastY + RADIUS, height - 1);
+	openChangedArea = CellArea{};
+
+	const std::span<const uint64_t> openWords = openPlane.GetWords();
+	const std::span<const uint64_t> frontierWords = frontierPlane.GetWords();
+	const std::span<uint64_t> flagWords = flagPlane.GetWords();
+
+	for (size_t y = firstY; y <= lastY; ++y)
+	{
+		const size_t rowBegin = y * width + firstX;
+		const size_t rowEnd = y * width + lastX + 1;
+
+		for (size_t wordIndex = rowBegin / 64; wordIndex * 64 < rowEnd; ++wordIndex)
+		{
+			const size_t firstBit = std::max(rowBegin, wordIndex * 64) - wordIndex * 64;
+			const size_t bitsEnd = std::min(rowEnd, wordIndex * 64 + 64) - wordIndex * 64;
+			const uint64_t rangeBits = (bitsEnd == 64 ? ~uint64_t{0} : (uint64_t{1} << bitsEnd) - 1) & ~((uint64_t{1} << firstBit) - 1);
+
+			flagWords[wordIndex] |= openWords[wordIndex] & frontierWords[wordIndex] & rangeBits;
+		}
+	}
+
+	firstDirtyConstraint = std::min(firstDirtyConstraint, firstY * width + firstX);
+}
+
+// Goes over the whole board, which is only needed when the whole board changes at once.
+// Only open cells can be on the open frontier or make their neighbors part of the closed one
+void Board::RebuildFrontier()
+{
+	frontierPlane.ClearAll();
+	firstDirtyConstraint = cellsAmount;
+	openChangedArea = CellArea{};
+
+	// Open cells with nothing closed around them can't be on the frontier, and are skipped a word at a time
+	const std::span<const uint64_t> openWords = openPlane.GetWords();
+	for (size_t wordIndex = 0; wordIndex < openWords.size(); ++wordIndex)
+	{
+		if (openWords[wordIndex] == 0)
+		{
+			continue;
+		}
+
+		for (uint64_t openBits = openWords[wordIndex] & ~GetEnclosedCells(wordIndex); openBits != 0; openBits &= openBits - 1)
+		{
+			const size_t cellIndex = wordIndex * 64 + static_cast<size_t>(std::countr_zero(openBits));
+			UpdateFrontierMembership(cellIndex);
+
+			if (frontierPlane.Test(cellIndex))
+			{
+				const auto addUnknownCell = [this](const size_t adjacentIndex)
+				{
+					if (this->IsUnknown(adjacentIndex))
+					{
+						this->frontierPlane.Set(adjacentIndex);
+					}
+				};
+				ProcessCellNeighbors(cellIndex, addUnknownCell);
+			}
 		}
 	}
+
+	// Loading a game shouldn't chord anything until the player does something
+	autoChordCandidates.Clear();
+	autoChordRefillPosition = NO_REFILL;
 }
 
-void Board::ProcessCellNeighbors(Cell& cellToProcess, const CallbackOnAdjacentCells& callback)
+// The cells of the word whose neighbors are all open, where cells past the edges of the board count as open.
+// The neighbors are read as whole words shifted by their offset, and a shift to the left or right wraps around the rows,
+// so the cells in the first and last columns take the cells they'd wrap around to as open
+uint64_t Board::GetEnclosedCells(const size_t& wordIndex) const
 {
-	Cell* adjacentCell;
-	auto [x, y] = cellToProcess.GetCellPosition();
+	const size_t firstCellIndex = wordIndex * 64;
+	const size_t wordEnd = firstCellIndex + 64;
+
+	uint64_t firstColumnBits = 0;
+	for (size_t cellIndex = firstCellIndex + (width - firstCellIndex % width) % width; cellIndex < wordEnd; cellIndex += width)
+	{
+		firstColumnBits |= uint64_t{1} << (cellIndex - firstCellIndex);
+	}
 
-	//[o] []  []
-	//[]  x   []
-	//[]  []  []
-	x -= 1;
-	y -= 1;
-	if (x >= 0 && y >= 0)
+	uint64_t lastColumnBits = 0;
+	for (size_t cellIndex = firstCellIndex + (width - 1 - firstCellIndex % width); cellIndex < wordEnd; cellIndex += width)
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		lastColumnBits |= uint64_t{1} << (cellIndex - firstCellIndex);
 	}
 
-	//[]  [o] []
-	//[]  x   []
-	//[]  []  []
-	x += 1;
-	if (y >= 0)
+	const auto first = static_cast<ptrdiff_t>(firstCellIndex);
+	const auto rowOffset = static_cast<ptrdiff_t>(width);
+	const auto getOpenBits = [first, this](const ptrdiff_t offset) { return this->openPlane.GetWordAt(first + offset, true); };
+
+	return getOpenBits(-rowOffset) & getOpenBits(rowOffset)
+		& (getOpenBits(-1) | firstColumnBits) & (getOpenBits(-rowOffset - 1) | firstColumnBits) & (getOpenBits(rowOffset - 1) | firstColumnBits)
+		& (getOpenBits(1) | lastColumnBits) & (getOpenBits(-rowOffset + 1) | lastColumnBits) & (getOpenBits(rowOffset + 1) | lastColumnBits);
+}
+
+// Nothing in the session buffers is needed once a game is over, so they let go of their memory before the arena
+// takes all of it back. They're then reserved again from the start of the arena, and never grow past that mid-game,
+// so the arena never has to go back to the heap
+void Board::ReserveSessionBuffers()
+{
+	revealStack = std::pmr::vector<size_t>(&sessionArena);
+	cellChanges = std::pmr::vector<CellChange>(&sessionArena);
+	actionHistory = std::pmr::vector<Action>(&sessionArena);
+	actionChanges = std::pmr::vector<ActionRun>(&sessionArena);
+	autoChordCandidates = IndexSet(&sessionArena);
+	sessionArena.release();
+
+	const size_t bufferCapacity = std::min(cellsAmount, BUFFER_CAPACITY);
+	revealStack.reserve(bufferCapacity);
+	cellChanges.reserve(CELL_CHANGES_CAPACITY);
+
+	// Every action has at least one run, so the actions never outnumber the runs
+	actionChanges.reserve(GetActionHistoryCapacity(cellsAmount));
+	actionHistory.reserve(GetActionHistoryCapacity(cellsAmount));
+	autoChordCandidates = IndexSet(bufferCapacity, &sessionArena);
+}
+
+// Exactly what ReserveSessionBuffers reserves, so a reset never has to go past the arena's own memory
+size_t Board::GetSessionArenaSize(const size_t& boardCellsAmount)
+{
+	const size_t bufferCapacity = std::min(boardCellsAmount, BUFFER_CAPACITY);
+
+	return bufferCapacity * sizeof(size_t)
+		+ CELL_CHANGES_CAPACITY * sizeof(CellChange)
+		+ GetActionHistoryCapacity(boardCellsAmount) * (sizeof(ActionRun) + sizeof(Action))
+		+ IndexSet::GetReservedBytes(bufferCapacity)
+		+ alignof(std::max_align_t) * 8; // Room for aligning each buffer
+}
+
+// Small boards only get as many runs as they have cells, which is still enough for a whole game of single cells
+size_t Board::GetActionHistoryCapacity(const size_t& boardCellsAmount)
+{
+	return std::clamp(boardCellsAmount, size_t{64}, BUFFER_CAPACITY);
+}
+
+// Starting a new action throws away every action that was undone
+void Board::BeginAction()
+{
+	actionHistory.resize(actionsApplied);
+	actionChanges.resize(actionsApplied > 0 ? actionHistory.back().changesEnd : 0);
+	isRecordingAction = true;
+}
+
+// A cell right after the action's last run in the same row only makes that run longer
+void Board::RecordActionChange(const size_t& cellIndex)
+{
+	if (!isRecordingAction)
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		return;
 	}
 
-	//[]  []  [o]
-	//[]  x   []
-	//[]  []  []
-	x += 1;
-	if (x < width && y >= 0)
+	const auto row = static_cast<uint32_t>(cellIndex / width);
+	const auto x = static_cast<uint32_t>(cellIndex % width);
+
+	if (actionChanges.size() > GetActionChangesBegin(actionsApplied))
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		ActionRun& lastRun = actionChanges.back();
+		if (lastRun.row == row && lastRun.firstX + lastRun.cellsAmount == x)
+		{
+			lastRun.cellsAmount++;
+			return;
+		}
 	}
 
-	//[]  []  []
-	//[o] x   []
-	//[]  []  []
-	x -= 2;
-	y += 1;
-	if (x >= 0)
+	if (actionChanges.size() == actionChanges.capacity())
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		TrimActionHistory();
+
+		if (!isRecordingAction)
+		{
+			return;
+		}
 	}
 
-	//[]  []  []
-	//[]  x   [o]
-	//[]  []  []
-	x += 2;
-	if (x < width)
+	actionChanges.push_back(ActionRun{row, x, 1});
+}
+
+void Board::EndAction(const ActionType& type)
+{
+	isRecordingAction = false;
+
+	const size_t changesEnd = actionChanges.size();
+	if (changesEnd == GetActionChangesBegin(actionsApplied))
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		return;
 	}
 
-	//[]  []  []
-	//[]  x   []
-	//[o] []  []
-	x -= 2;
-	y += 1;
-	if (x >= 0 && y < height)
+	actionHistory.push_back(Action{type, changesEnd});
+	actionsApplied++;
+}
+
+// Makes room in the full history by forgetting the oldest actions, at least half of the history's worth of runs,
+// so trimming only takes a constant time per run on average. If the actions before the one that's being recorded
+// don't take up half of it, the new action is too large to undo, and so is everything before it
+void Board::TrimActionHistory()
+{
+	const size_t halfCapacity = actionChanges.capacity() / 2;
+
+	size_t forgottenActions = 0;
+	while (forgottenActions < actionsApplied && GetActionChangesBegin(forgottenActions) < halfCapacity)
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		forgottenActions++;
 	}
 
-	//[]  []  []
-	//[]  x   []
-	//[]  [o] []
-	x += 1;
-	if (y < height)
+	const size_t forgottenRuns = GetActionChangesBegin(forgottenActions);
+	if (forgottenRuns < halfCapacity)
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		ClearActionHistory();
+		return;
 	}
 
-	//[]  []  []
-	//[]  x   []
-	//[]  []  [o]
-	x += 1;
-	if (x < width && y < height)
+	actionChanges.erase(actionChanges.begin(), actionChanges.begin() + static_cast<std::ptrdiff_t>(forgottenRuns));
+	actionHistory.erase(actionHistory.begin(), actionHistory.begin() + static_cast<std::ptrdiff_t>(forgottenActions));
+	for (Action& action : actionHistory)
 	{
-		adjacentCell = &cells[y * width + x];
-		callback(cellToProcess, *adjacentCell);
+		action.changesEnd -= forgottenRuns;
 	}
+	actionsApplied -= forgottenActions;
+}
+
+void Board::ClearActionHistory()
+{
+	actionHistory.clear();
+	actionChanges.clear();
+	actionsApplied = 0;
+	isRecordingAction = false;
+}
+
+size_t Board::GetActionChangesBegin(const size_t& actionIndex) const
+{
+	return actionIndex > 0 ? actionHistory[actionIndex - 1].changesEnd : 0;
+}
+
+// How many columns and rows of cells fit between the board's top left corner and the edges of the screen
+// The layout never shows more than MAX_LAYOUT_BOARD_DIMENSION_CELLS in either direction, see GetVisibleCellsAmount
+void Board::ReserveView(BoardView& view) const
+{
+	const auto maxVisibleCells = [](const size_t boardSizeCells)
+	{
+		return std::min(boardSizeCells, static_cast<size_t>(Settings::MAX_LAYOUT_BOARD_DIMENSION_CELLS));
+	};
+
+	view.spriteKeys.reserve(maxVisibleCells(width) * maxVisibleCells(height));
+}
+
+Vec2<int> Board::GetVisibleCellsAmount() const
+{
+	return GetVisibleCellsAmount(Vec2<int>{GetScreenWidth(), GetScreenHeight()});
+}
+
+Vec2<int> Board::GetVisibleCellsAmount(const Vec2<int>& screenSizePixels) const
+{
+	const auto getVisibleAmount = [this](const int screenSizePixels, const int boardPositionPixels, const size_t boardSizeCells)
+	{
+		const int visibleAmount = std::max(screenSizePixels - boardPositionPixels + this->cellSizePixels - 1, 0) / this->cellSizePixels;
+		// Never more than the layout was made for, so that a huge board doesn't draw over the games next to it
+		return static_cast<int>(std::min({
+			static_cast<size_t>(visibleAmount),
+			boardSizeCells,
+			static_cast<size_t>(Settings::MAX_LAYOUT_BOARD_DIMENSION_CELLS)
+		}));
+	};
+
+	return {
+		getVisibleAmount(screenSizePixels.x, screenPositionPixels.x, width),
+		getVisibleAmount(screenSizePixels.y, screenPositionPixels.y, height)
+	};
+}
+
+bool Board::IsCellVisible(const size_t& cellIndex) const
+{
+	const Vec2<int> visibleCells = GetVisibleCellsAmount();
+	return cellIndex % width < static_cast<size_t>(visibleCells.x) && cellIndex / width < static_cast<size_t>(visibleCells.y);
+}
+
+Vec2<int> Board::GetCellScreenPosition(const size_t& cellIndex) const
+{
+	const Vec2<int> cellPosition{static_cast<int>(cellIndex % width), static_cast<int>(cellIndex / width)};
+	return screenPositionPixels + cellPosition * cellSizePixels;
+}
+
+uint8_t Board::GetOverlayKey(const size_t& cellIndex) const
+{
+	using namespace BoardSprite;
+
+	const bool isPressed = cellIndex == clickPreviewCell || previewChordedCells.Contains(cellIndex);
+	return (cellIndex == highlightedCell ? KEY_HIGHLIGHTED : 0) | (isPressed ? KEY_PRESSED : 0);
 }
 
 void Board::WinGame()
 {
 	boardState = GAME_WON;
 	cellsLeftToFlag = 0;
+	RecordTransition(BoardTickChanges::GAME_WON);
 
 	NotifyFlagToggleObservers();
 	NotifyGameWonObservers();
@@ -581,6 +1796,7 @@ void Board::WinGame()
 void Board::LoseGame()
 {
 	boardState = GAME_LOST;
+	RecordTransition(BoardTickChanges::GAME_LOST);
 
 	NotifyGameLostObservers();
 
@@ -0,0 +1,595 @@
+#include "board_simulation.h"
+#include "allocation_tracker.h"
+#include "settings.h"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined DEBUG
+#include <iostream>
+#endif
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+BoardSimulation::BoardSimulation(const Vec2<int> screenPos,
+                                 const int cellSize,
+                                 const size_t boardWidthCells,
+                                 const size_t boardHeightCells,
+                                 const uint64_t maxMinesAmount,
+                                 const bool autoChord,
+                                 const bool threaded,
+                                 const std::string& sharedBoardName)
+	: board(screenPos, cellSize, boardWidthCells, boardHeightCells, maxMinesAmount, autoChord),
+	  isThreaded(threaded)
+{
+	if (!sharedBoardName.empty())
+	{
+		isStateShared = board.ShareState(sharedBoardName);
+
+#if defined DEBUG
+		if (!isStateShared)
+		{
+			std::cout << "Could not share the board as " << sharedBoardName << "\n";
+		}
+#endif
+	}
+
+	if (!isThreaded)
+	{
+		return;
+	}
+
+	outgoingCommands.reserve(COMMAND_BATCH_CAPACITY);
+	receivedNotifications.reserve(NOTIFICATION_BATCH_CAPACITY);
+	receivedCellChanges.reserve(CELL_CHANGE_BATCH_CAPACITY);
+	pendingCommands.reserve(COMMAND_BATCH_CAPACITY);
+	pendingNotifications.reserve(NOTIFICATION_BATCH_CAPACITY);
+	pendingCellChanges.reserve(CELL_CHANGE_BATCH_CAPACITY);
+	stepCommands.reserve(COMMAND_BATCH_CAPACITY);
+	stepMouseStates.reserve(COMMAND_BATCH_CAPACITY); // A step never has more mouse states than commands
+	stepNotifications.reserve(NOTIFICATION_BATCH_CAPACITY);
+	stepCellChanges.reserve(CELL_CHANGE_BATCH_CAPACITY);
+	views.ForEachBuffer([this](BoardView& view) { board.ReserveView(view); });
+
+	// The simulation thread is the board's only observer, it passes everything on to the observers attached here
+	board.Attach(this);
+	simulationThread = std::thread(&BoardSimulation::RunSimulation, this);
+}
+
+BoardSimulation::~BoardSimulation()
+{
+	if (!isThreaded)
+	{
+		return;
+	}
+
+	{
+		const std::lock_guard lock(batchMutex);
+		isStopRequested = true;
+	}
+	commandsSent.notify_one();
+	notificationsTaken.notify_one();
+	simulationThread.join();
+}
+
+void BoardSimulation::Attach(IObserver* observer)
+{
+	observers.push_back(observer);
+
+	if (!isThreaded)
+	{
+		board.Attach(observer);
+	}
+}
+
+void BoardSimulation::Detach(IObserver* observer)
+{
+	observers.remove(observer);
+
+	if (!isThreaded)
+	{
+		board.Detach(observer);
+	}
+}
+
+void BoardSimulation::Update()
+{
+	if (!isThreaded)
+	{
+		board.Update();
+		return;
+	}
+
+	if (const Vec2<int> currentScreenSize{GetScreenWidth(), GetScreenHeight()}; currentScreenSize != sentScreenSize)
+	{
+		sentScreenSize = currentScreenSize;
+		SendCommand(Command{.type = Command::SET_SCREEN_SIZE, .position = currentScreenSize});
+	}
+
+	// The bots' moves are played before the mouse's, like Board::Update does
+	if (isStateShared)
+	{
+		SendCommand(Command{.type = Command::PLAY_SHARED_MOVES});
+	}
+
+	if (IsCursorOnScreen())
+	{
+		for (const MouseState& mouseState : InputQueue::GetInstance().GetMouseStates())
+		{
+			SendCommand(Command{.type = Command::MOUSE_STATE, .mouseState = mouseState});
+		}
+	}
+
+	{
+		const std::lock_guard lock(batchMutex);
+		if (pendingCommands.empty())
+		{
+			std::swap(pendingCommands, outgoingCommands);
+		}
+		else
+		{
+			// The simulation thread hasn't taken the last frame's commands yet
+			for (const Command& command : outgoingCommands)
+			{
+				AddToBatch(pendingCommands, command);
+			}
+		}
+	}
+	commandsSent.notify_one();
+	outgoingCommands.clear();
+}
+
+void BoardSimulation::Draw() const
+{
+	if (!isThreaded)
+	{
+		board.Draw();
+		return;
+	}
+
+	if (latestView != nullptr)
+	{
+		latestView->Draw();
+	}
+}
+
+void BoardSimulation::Reset()
+{
+	SendCommand(Command{.type = Command::RESET});
+}
+
+void BoardSimulation::SetLayout(const Vec2<int>& screenPos, const int& cellSize)
+{
+	SendCommand(Command{.type = Command::SET_LAYOUT, .position = screenPos, .cellSize = cellSize});
+}
+
+void BoardSimulation::NotifyFlagToggleObservers()
+{
+	SendCommand(Command{.type = Command::NOTIFY_FLAG_COUNT});
+}
+
+void BoardSimulation::Undo()
+{
+	SendCommand(Command{.type = Command::UNDO});
+}
+
+void BoardSimulation::Redo()
+{
+	SendCommand(Command{.type = Command::REDO});
+}
+
+void BoardSimulation::ShowHint()
+{
+	SendCommand(Command{.type = Command::SHOW_HINT});
+}
+
+void BoardSimulation::SaveSnapshot(const double timeElapsed)
+{
+	SendCommand(Command{.type = Command::SAVE_SNAPSHOT, .timeElapsed = timeElapsed});
+}
+
+void BoardSimulation::LoadSnapshot()
+{
+	SendCommand(Command{.type = Command::LOAD_SNAPSHOT});
+}
+
+// The notifications keep the order the board sent them in, and each batch of cell changes is sent to the
+// observers as its own span, so the observers can't tell whether the board is running on another thread
+void BoardSimulation::DispatchNotifications()
+{
+	if (!isThreaded)
+	{
+		board.EndTick();
+		return;
+	}
+
+	{
+		const std::lock_guard lock(batchMutex);
+		std::swap(pendingNotifications, receivedNotifications);
+		std::swap(pendingCellChanges, receivedCellChanges);
+	}
+	notificationsTaken.notify_one();
+
+	// The views are published before the notifications are sent, so this view already shows what they report
+	latestView = &views.GetLatest();
+
+	size_t cellChangesBegin = 0;
+	for (const Notification& notification : receivedNotifications)
+	{
+		switch (notification.type)
+		{
+		case Notification::GAME_STARTED:
+			NotifyObservers<IObserverGameStart>([](IObserverGameStart& observer) { observer.OnGameStarted(); });
+			break;
+		case Notification::FLAG_TOGGLED:
+			NotifyObservers<IObserverFlagToggle>([&notification](IObserverFlagToggle& observer)
+			{
+				observer.OnToggledCellFlag(notification.amount);
+			});
+			break;
+		case Notification::MOUSE_BUTTON_DOWN:
+			NotifyObservers<IObserverBoardMouseButtonDown>([](IObserverBoardMouseButtonDown& observer) { observer.OnBoardMouseButtonDown(); });
+			break;
+		case Notification::GAME_WON:
+			NotifyObservers<IObserverGameWon>([](IObserverGameWon& observer) { observer.OnGameWon(); });
+			break;
+		case Notification::GAME_LOST:
+			NotifyObservers<IObserverGameLost>([](IObserverGameLost& observer) { observer.OnGameLost(); });
+			break;
+		case Notification::CELLS_CHANGED:
+		{
+			const std::span<const CellChange> changes =
+				std::span<const CellChange>(receivedCellChanges).subspan(cellChangesBegin, static_cast<size_t>(notification.amount));
+			cellChangesBegin += changes.size();
+
+			NotifyObservers<IObserverCellChange>([changes](IObserverCellChange& observer) { observer.OnCellsChanged(changes); });
+			break;
+		}
+		case Notification::BOARD_CLEARED:
+			NotifyObservers<IObserverCellChange>([](IObserverCellChange& observer) { observer.OnBoardCleared(); });
+			break;
+		case Notification::SNAPSHOT_LOADED:
+			NotifySnapshotLoadObservers(notification.time);
+			break;
+		case Notification::INPUT_CHANGED_CELLS:
+			if (changingInputTime == Board::NO_INPUT_TIME)
+			{
+				changingInputTime = notification.time;
+			}
+			break;
+		}
+	}
+
+	receivedNotifications.clear();
+	receivedCellChanges.clear();
+}
+
+bool BoardSimulation::IsGameInProgress() const
+{
+	if (!isThreaded)
+	{
+		return board.IsGameInProgress();
+	}
+
+	return latestView != nullptr && latestView->isGameInProgress;
+}
+
+double BoardSimulation::TakeChangingInputTime()
+{
+	if (!isThreaded)
+	{
+		return board.TakeChangingInputTime();
+	}
+
+	const double inputTime = changingInputTime;
+	changingInputTime = Board::NO_INPUT_TIME;
+
+	return inputTime;
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+// Without a simulation thread, the commands are carried out right away
+void BoardSimulation::SendCommand(const Command& command)
+{
+	if (!isThreaded)
+	{
+		Execute(command);
+		return;
+	}
+
+	AddToBatch(outgoingCommands, command);
+}
+
+// The batches are swapped between the threads, and all of them are reserved for COMMAND_BATCH_CAPACITY commands,
+// so sending commands never allocates, however far the simulation thread falls behind. Mouse states that don't
+// release a button only decide what's highlighted until the next one arrives, so once a batch is half full they're
+// merged into the one before them, and a full batch drops them to make room. Clicks and the other commands are only
+// dropped if the batch is full of them, which takes the simulation thread being stuck for a long time
+void BoardSimulation::AddToBatch(std::vector<Command>& batch, const Command& command)
+{
+	if (IsMouseMove(command) && batch.size() >= COMMAND_BATCH_CAPACITY / 2 && IsMouseMove(batch.back()))
+	{
+		batch.back() = command;
+		return;
+	}
+
+	if (batch.size() == COMMAND_BATCH_CAPACITY)
+	{
+		std::erase_if(batch, IsMouseMove);
+	}
+
+	if (batch.size() == COMMAND_BATCH_CAPACITY)
+	{
+#if defined DEBUG
+		std::cout << "The board is too far behind, a command was dropped\n";
+#endif
+		return;
+	}
+
+	batch.push_back(command);
+}
+
+bool BoardSimulation::IsMouseMove(const Command& command)
+{
+	const std::array<bool, 3>& released = command.mouseState.buttonsReleased;
+
+	return command.type == Command::MOUSE_STATE && std::ranges::none_of(released, [](const bool isReleased) { return isReleased; });
+}
+
+void BoardSimulation::Execute(const Command& command)
+{
+	switch (command.type)
+	{
+	case Command::MOUSE_STATE:
+		assert(false && "Mouse states are processed in batches");
+		break;
+	case Command::SET_LAYOUT:
+		board.SetLayout(command.position, command.cellSize);
+		break;
+	case Command::SET_SCREEN_SIZE:
+		screenSize = command.position;
+		break;
+	case Command::RESET:
+		board.Reset();
+		break;
+	case Command::NOTIFY_FLAG_COUNT:
+		board.NotifyFlagToggleObservers();
+		break;
+	case Command::UNDO:
+		board.Undo();
+		break;
+	case Command::REDO:
+		board.Redo();
+		break;
+	case Command::SHOW_HINT:
+		board.ShowHint();
+		break;
+	case Command::SAVE_SNAPSHOT:
+	{
+		const AllocationTracker::ScopedAllowance allowSaveBuffers;
+
+		if (!board.SaveSnapshot(Settings::SAVE_FILE_PATH, command.timeElapsed))
+		{
+#if defined DEBUG
+			std::cout << "Could not save the game\n";
+#endif
+		}
+		break;
+	}
+	case Command::LOAD_SNAPSHOT:
+	{
+		const AllocationTracker::ScopedAllowance allowLoadBuffers;
+
+		double timeElapsed = 0;
+		if (!board.LoadSnapshot(Settings::SAVE_FILE_PATH, timeElapsed))
+		{
+#if defined DEBUG
+			std::cout << "Could not load the game\n";
+#endif
+		}
+		else if (isThreaded)
+		{
+			PushNotification(Notification{.type = Notification::SNAPSHOT_LOADED, .time = timeElapsed});
+		}
+		else
+		{
+			NotifySnapshotLoadObservers(timeElapsed);
+		}
+		break;
+	}
+	case Command::PLAY_SHARED_MOVES:
+		board.PlaySharedMoves();
+		break;
+	}
+}
+
+// The simulation thread sleeps until there's something to do, since the board never changes on its own
+void BoardSimulation::RunSimulation()
+{
+	while (true)
+	{
+		{
+			std::unique_lock lock(batchMutex);
+			commandsSent.wait(lock, [this] { return isStopRequested || !pendingCommands.empty(); });
+
+			if (isStopRequested)
+			{
+				return;
+			}
+
+			std::swap(pendingCommands, stepCommands);
+		}
+
+		Step();
+	}
+}
+
+void BoardSimulation::Step()
+{
+	for (const Command& command : stepCommands)
+	{
+		if (command.type == Command::MOUSE_STATE)
+		{
+			stepMouseStates.push_back(command.mouseState);
+			continue;
+		}
+
+		// The mouse states are handled together, like the board does on the window's thread,
+		// but never after a command that was sent after them
+		ProcessStepMouseStates();
+		Execute(command);
+	}
+
+	ProcessStepMouseStates();
+	stepCommands.clear();
+
+	board.EndTick();
+	if (const double inputTime = board.TakeChangingInputTime(); inputTime != Board::NO_INPUT_TIME)
+	{
+		PushNotification(Notification{.type = Notification::INPUT_CHANGED_CELLS, .time = inputTime});
+	}
+
+	SendStepBatches();
+}
+
+void BoardSimulation::ProcessStepMouseStates()
+{
+	if (stepMouseStates.empty())
+	{
+		return;
+	}
+
+	board.ProcessMouseStates(stepMouseStates, screenSize);
+	stepMouseStates.clear();
+}
+
+// The view is published before the step's batches are sent, so it already shows what they report.
+// The pending batches are reserved for as much as a step's batches can hold, so they never grow either:
+// if the window's thread hasn't taken enough of them to make room, the board waits for it to
+void BoardSimulation::SendStepBatches()
+{
+	board.CopyView(views.GetWriteBuffer(), screenSize);
+	views.Publish();
+
+	{
+		std::unique_lock lock(batchMutex);
+		notificationsTaken.wait(lock, [this]
+		{
+			return isStopRequested
+				|| (pendingNotifications.size() + stepNotifications.size() <= NOTIFICATION_BATCH_CAPACITY
+					&& pendingCellChanges.size() + stepCellChanges.size() <= CELL_CHANGE_BATCH_CAPACITY);
+		});
+
+		// Once a stop is requested, nothing is going to take them anymore
+		if (!isStopRequested)
+		{
+			if (pendingNotifications.empty() && pendingCellChanges.empty())
+			{
+				std::swap(pendingNotifications, stepNotifications);
+				std::swap(pendingCellChanges, stepCellChanges);
+			}
+			else
+			{
+				pendingNotifications.insert(pendingNotifications.end(), stepNotifications.begin(), stepNotifications.end());
+				pendingCellChanges.insert(pendingCellChanges.end(), stepCellChanges.begin(), stepCellChanges.end());
+			}
+		}
+	}
+
+	stepNotifications.clear();
+	stepCellChanges.clear();
+}
+
+// The observers only keep the latest flag count and face, and the earliest input time, so a notification that
+// only repeats the last one is merged into it. So are cell changes that follow each other, which keeps a long reveal
+// from filling the batch with notifications. A full batch is sent in the middle of the step, see SendStepBatches
+void BoardSimulation::PushNotification(const Notification& notification)
+{
+	if (!stepNotifications.empty() && stepNotifications.back().type == notification.type)
+	{
+		switch (notification.type)
+		{
+		case Notification::FLAG_TOGGLED:
+			stepNotifications.back().amount = notification.amount;
+			return;
+		case Notification::CELLS_CHANGED:
+			stepNotifications.back().amount += notification.amount;
+			return;
+		case Notification::MOUSE_BUTTON_DOWN:
+		case Notification::INPUT_CHANGED_CELLS:
+			return;
+		default:
+			break;
+		}
+	}
+
+	if (stepNotifications.size() == NOTIFICATION_BATCH_CAPACITY)
+	{
+		SendStepBatches();
+	}
+
+	stepNotifications.push_back(notification);
+}
+
+void BoardSimulation::NotifySnapshotLoadObservers(const double& timeElapsed)
+{
+	NotifyObservers<IObserverSnapshotLoad>([timeElapsed](IObserverSnapshotLoad& observer) { observer.OnSnapshotLoaded(timeElapsed); });
+}
+
+void BoardSimulation::OnGameStarted()
+{
+	PushNotification(Notification{.type = Notification::GAME_STARTED});
+}
+
+void BoardSimulation::OnToggledCellFlag(const int64_t& minesLeftToFlag)
+{
+	PushNotification(Notification{.type = Notification::FLAG_TOGGLED, .amount = minesLeftToFlag});
+}
+
+void BoardSimulation::OnBoardMouseButtonDown()
+{
+	PushNotification(Notification{.type = Notification::MOUSE_BUTTON_DOWN});
+}
+
+void BoardSimulation::OnGameWon()
+{
+	PushNotification(Notification{.type = Notification::GAME_WON});
+}
+
+void BoardSimulation::OnGameLost()
+{
+	PushNotification(Notification{.type = Notification::GAME_LOST});
+}
+
+// The board reuses its buffer of changes, so they're copied into the step's batch, as much at a time as fits in it
+void BoardSimulation::OnCellsChanged(std::span<const CellChange> changes)
+{
+	while (!changes.empty())
+	{
+		if (stepCellChanges.size() == CELL_CHANGE_BATCH_CAPACITY)
+		{
+			SendStepBatches();
+		}
+
+		// The notification goes first, in case it has to send the batches to make room for itself
+		const std::span<const CellChange> copied = changes.first(std::min(changes.size(), CELL_CHANGE_BATCH_CAPACITY - stepCellChanges.size()));
+		PushNotification(Notification{.type = Notification::CELLS_CHANGED, .amount = static_cast<int64_t>(copied.size())});
+
+		stepCellChanges.insert(stepCellChanges.end(), copied.begin(), copied.end());
+		changes = changes.subspan(copied.size());
+	}
+}
+
+void BoardSimulation::OnBoardCleared()
+{
+	PushNotification(Notification{.type = Notification::BOARD_CLEARED});
+}
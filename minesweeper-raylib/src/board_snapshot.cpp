@@ -0,0 +1,230 @@
+#include "board.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+#if defined DEBUG
+#include <iostream>
+#endif
+
+namespace
+{
+	constexpr uint32_t SNAPSHOT_MAGIC = 0x5057534D; // "MSWP"
+	constexpr uint32_t SNAPSHOT_VERSION = 2; // Version 2 widened the board dimensions and counters to 64 bits
+
+	struct SnapshotHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint64_t width;
+		uint64_t height;
+		uint64_t maxMines;
+		int64_t cellsLeftToFlag;
+		uint32_t seed;
+		uint32_t padding;
+		double timeElapsed;
+	};
+
+	// FNV-1a, which is plenty to catch truncated or corrupted save files
+	uint64_t CalculateChecksum(const uint8_t* data, const size_t size)
+	{
+		uint64_t hash = 0xCBF29CE484222325;
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= data[i];
+			hash *= 0x100000001B3;
+		}
+
+		return hash;
+	}
+
+	// The planes are stored as the bytes of the board's own words, in the machine's byte order like the header,
+	// and the last word is cut off after the byte with the last cell
+	uint64_t ReadPlaneWord(const uint8_t* planeBytes, const size_t planeSize, const size_t wordIndex)
+	{
+		const size_t byteOffset = wordIndex * sizeof(uint64_t);
+
+		uint64_t word = 0;
+		std::memcpy(&word, planeBytes + byteOffset, std::min(sizeof(uint64_t), planeSize - byteOffset));
+		return word;
+	}
+
+	uint64_t GetPastEndBits(const size_t cellsAmount, const size_t wordIndex)
+	{
+		const size_t wordEnd = (wordIndex + 1) * 64;
+		return wordEnd > cellsAmount ? ~uint64_t{0} << (64 - (wordEnd - cellsAmount)) : 0;
+	}
+}
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+bool Board::SaveSnapshot(const std::string& filePath, const double timeElapsed) const
+{
+	if (!IsGameInProgress())
+	{
+		return false;
+	}
+
+	const size_t planeSize = (cellsAmount + 7) / 8;
+	const SnapshotHeader header{
+		SNAPSHOT_MAGIC,
+		SNAPSHOT_VERSION,
+		width,
+		height,
+		maxMinesOnBoard,
+		cellsLeftToFlag,
+		seed,
+		0,
+		timeElapsed
+	};
+
+	// The whole file is built in memory first, so it can be written with a single call
+	std::vector<uint8_t> snapshot(sizeof(SnapshotHeader) + planeSize * 3 + sizeof(uint64_t), 0);
+	std::memcpy(snapshot.data(), &header, sizeof(SnapshotHeader));
+
+	uint8_t* minePlaneBytes = snapshot.data() + sizeof(SnapshotHeader);
+	uint8_t* openPlaneBytes = minePlaneBytes + planeSize;
+	uint8_t* flagPlaneBytes = openPlaneBytes + planeSize;
+
+	// The flag bits of open cells only mark their constraints as dirty, so they're left out
+	const std::span<const uint64_t> mineWords = minePlane.GetWords();
+	const std::span<const uint64_t> openWords = openPlane.GetWords();
+	const std::span<const uint64_t> flagWords = flagPlane.GetWords();
+	for (size_t wordIndex = 0; wordIndex < openWords.size(); ++wordIndex)
+	{
+		const uint64_t flaggedBits = flagWords[wordIndex] & ~openWords[wordIndex];
+		const size_t byteOffset = wordIndex * sizeof(uint64_t);
+		const size_t bytesAmount = std::min(sizeof(uint64_t), planeSize - byteOffset);
+
+		std::memcpy(minePlaneBytes + byteOffset, &mineWords[wordIndex], bytesAmount);
+		std::memcpy(openPlaneBytes + byteOffset, &openWords[wordIndex], bytesAmount);
+		std::memcpy(flagPlaneBytes + byteOffset, &flaggedBits, bytesAmount);
+	}
+
+	const size_t checksumOffset = snapshot.size() - sizeof(uint64_t);
+	const uint64_t checksum = CalculateChecksum(snapshot.data(), checksumOffset);
+	std::memcpy(snapshot.data() + checksumOffset, &checksum, sizeof(uint64_t));
+
+	std::ofstream file{filePath, std::ios::binary | std::ios::trunc};
+	file.write(reinterpret_cast<const char*>(snapshot.data()), static_cast<std::streamsize>(snapshot.size()));
+
+#if defined DEBUG
+	std::cout << "Saved snapshot to " << filePath << " (" << snapshot.size() << " bytes)\n";
+#endif
+
+	return file.good();
+}
+
+bool Board::LoadSnapshot(const std::string& filePath, double& timeElapsed)
+{
+	std::ifstream file{filePath, std::ios::binary | std::ios::ate};
+	if (!file.good())
+	{
+		return false;
+	}
+
+	// Read the whole file in one go, instead of parsing it piece by piece from the stream
+	const auto fileSize = static_cast<size_t>(file.tellg());
+	const size_t planeSize = (cellsAmount + 7) / 8;
+	if (fileSize != sizeof(SnapshotHeader) + planeSize * 3 + sizeof(uint64_t))
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> snapshot(fileSize);
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(snapshot.data()), static_cast<std::streamsize>(fileSize));
+	if (!file.good())
+	{
+		return false;
+	}
+
+	SnapshotHeader header{};
+	uint64_t checksum = 0;
+	std::memcpy(&header, snapshot.data(), sizeof(SnapshotHeader));
+	std::memcpy(&checksum, snapshot.data() + fileSize - sizeof(uint64_t), sizeof(uint64_t));
+
+	if (header.magic != SNAPSHOT_MAGIC
+		|| header.version != SNAPSHOT_VERSION
+		|| header.width != width
+		|| header.height != height
+		|| header.maxMines != maxMinesOnBoard
+		|| checksum != CalculateChecksum(snapshot.data(), fileSize - sizeof(uint64_t)))
+	{
+		return false;
+	}
+
+	const uint8_t* minePlaneBytes = snapshot.data() + sizeof(SnapshotHeader);
+	const uint8_t* openPlaneBytes = minePlaneBytes + planeSize;
+	const uint8_t* flagPlaneBytes = openPlaneBytes + planeSize;
+
+	// Only a hand edited file with a valid checksum could fail these, so they're checked before anything is changed.
+	// The file has to have all of its mines, no bits past the last cell, no open mines and no flags on open cells,
+	// and the flag count has to match its flags
+	uint64_t minesAmount = 0;
+	uint64_t flagsAmount = 0;
+	for (size_t wordIndex = 0; wordIndex < BitPlane::GetWordsAmount(cellsAmount); ++wordIndex)
+	{
+		const uint64_t mineBits = ReadPlaneWord(minePlaneBytes, planeSize, wordIndex);
+		const uint64_t openBits = ReadPlaneWord(openPlaneBytes, planeSize, wordIndex);
+		const uint64_t flagBits = ReadPlaneWord(flagPlaneBytes, planeSize, wordIndex);
+		const uint64_t pastEndBits = GetPastEndBits(cellsAmount, wordIndex);
+
+		if (((mineBits | openBits | flagBits) & pastEndBits) != 0 || (openBits & (mineBits | flagBits)) != 0)
+		{
+			return false;
+		}
+
+		minesAmount += static_cast<uint64_t>(std::popcount(mineBits));
+		flagsAmount += static_cast<uint64_t>(std::popcount(flagBits));
+	}
+
+	if (minesAmount != header.maxMines || header.cellsLeftToFlag != static_cast<int64_t>(header.maxMines) - static_cast<int64_t>(flagsAmount))
+	{
+		return false;
+	}
+
+	// Start from a clean board, then restore the states straight from the bitplanes
+	ClearCellOverlays();
+	mouseSelectedCell = NO_CELL;
+	explodedCellIndex = NO_CELL;
+	ClearActionHistory();
+	hintedCellIndex = NO_HINT;
+	RecordTransition(BoardTickChanges::BOARD_CLEARED);
+
+	const std::span<uint64_t> mineWords = minePlane.GetWords();
+	const std::span<uint64_t> openWords = openPlane.GetWords();
+	const std::span<uint64_t> flagWords = flagPlane.GetWords();
+	uint64_t cellsOpened = 0;
+	for (size_t wordIndex = 0; wordIndex < openWords.size(); ++wordIndex)
+	{
+		mineWords[wordIndex] = ReadPlaneWord(minePlaneBytes, planeSize, wordIndex);
+		openWords[wordIndex] = ReadPlaneWord(openPlaneBytes, planeSize, wordIndex);
+		flagWords[wordIndex] = ReadPlaneWord(flagPlaneBytes, planeSize, wordIndex);
+		cellsOpened += static_cast<uint64_t>(std::popcount(openWords[wordIndex]));
+	}
+
+	RecordWholeBoardChange();
+	RebuildFrontier();
+
+	cellsLeftToReveal = cellsAmount - maxMinesOnBoard - cellsOpened;
+	cellsLeftToFlag = header.cellsLeftToFlag;
+	seed = header.seed;
+	timeElapsed = header.timeElapsed;
+	boardState = IN_PROGRESS;
+	RecordTransition(BoardTickChanges::SNAPSHOT_LOADED);
+
+	NotifyFlagToggleObservers();
+
+#if defined DEBUG
+	std::cout << "Loaded snapshot from " << filePath << "\n";
+#endif
+
+	return true;
+}
@@ -1,185 +1,70 @@
 #include "board.h"
-#include "resources_singleton.h"
 
+using namespace BoardSprite;
 
-//	####################
-//	# Public functions #
-//	####################
 
+//	#####################
+//	# Private functions #
+//	#####################
 
-Board::Cell::Cell(const Vec2<int>&& pos)
-	: cellPosition(pos)
-{
-}
-
-void Board::Cell::Initialize(const bool& placeMine, const uint8_t& adjacentMines, const std::vector<Cell*>& neighborCells)
-{
-	hasMine = placeMine;
-	minesAdjacent = adjacentMines;
-	adjacentCells = neighborCells;
-}
 
-bool Board::Cell::ToggleFlag()
+// Open cells show their number, which is counted from the mine plane, since it's never stored
+uint8_t Board::GetSpriteKey(const size_t& cellIndex, const uint8_t& overlayKey) const
 {
-	if (!isOpen)
+	if (IsOpen(cellIndex))
 	{
-		isFlagged = !isFlagged;
+		return static_cast<uint8_t>(KEY_OPEN + CountAdjacentMines(cellIndex));
 	}
 
-	return isFlagged;
+	return static_cast<uint8_t>((flagPlane.Test(cellIndex) ? KEY_FLAGGED : 0)
+		| (HasMine(cellIndex) ? KEY_MINE : 0)
+		| (cellIndex == explodedCellIndex ? KEY_EXPLODED : 0)
+		| overlayKey);
 }
 
-void Board::Cell::Highlight(const bool& isActive)
+uint8_t Board::CountAdjacentMines(const size_t& cellIndex) const
 {
-	if (!isOpen)
+	const auto getMineBits = [this](const size_t firstCellIndex, const size_t amount)
 	{
-		isHighlighted = isActive;
-	}
+		return this->minePlane.GetBits(firstCellIndex, amount);
+	};
+
+	return CountAdjacentCells(cellIndex, getMineBits);
 }
 
-// DFS traversal of all adjacent cells until it hits a cell that is open, contains a mine, or is flagged.
-// Returns how many cells were revealed.
-int Board::Cell::Reveal()
+// Open cells never have a flag, so a cell is unknown if it's in neither plane, whatever the flag plane means on open cells
+bool Board::HasUnknownNeighbor(const size_t& cellIndex) const
 {
-	// Base case
-	if (isOpen || hasMine || isFlagged)
-	{
-		return 0;
-	}
-
-	isOpen = true;
-
-	if (minesAdjacent > 0)
+	const auto getUnknownBits = [this](const size_t firstCellIndex, const size_t amount)
 	{
-		return 1;
-	}
+		const uint64_t knownBits = this->openPlane.GetBits(firstCellIndex, amount) | this->flagPlane.GetBits(firstCellIndex, amount);
+		return ~knownBits & ((uint64_t{1} << amount) - 1);
+	};
 
-	int cellsRevealed = 1;
+	return CountAdjacentCells(cellIndex, getUnknownBits) > 0;
+}
 
-	// We don't need to worry about the adjacent cell we came from since that was opened in the previous function call
-	// and it will be handled by the base case in the next call
-	for (Cell* adjacentCell : adjacentCells)
+bool Board::HasOpenNumberedNeighbor(const size_t& cellIndex) const
+{
+	bool hasOpenNumberedNeighbor = false;
+	const auto inspectAdjacentCell = [&hasOpenNumberedNeighbor, this](const size_t adjacentIndex)
 	{
-		cellsRevealed += adjacentCell->Reveal();
-	}
+		hasOpenNumberedNeighbor = hasOpenNumberedNeighbor || this->IsOpenNumbered(adjacentIndex);
+	};
+	ProcessCellNeighbors(cellIndex, inspectAdjacentCell);
 
-	return cellsRevealed;
+	return hasOpenNumberedNeighbor;
 }
 
-void Board::Cell::Draw(const Vec2<int>& boardOriginPixels,
-                       const int& cellSizePixels,
-                       const bool& isGameWon,
-                       const bool& isGameLost) const
+void Board::DrawCell(const size_t& cellIndex,
+                     const ResourcesSingleton::ScaledAtlases& atlases,
+                     const BoardSprite::Outcome& outcome,
+                     const uint8_t& overlayKey) const
 {
-	const Vec2<int> topLeft = boardOriginPixels + (cellPosition * cellSizePixels);
-	const Rectangle spriteRect = GetCellSprite(isGameWon, isGameLost);
-
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetCellAtlasTexture(),
-		spriteRect,
-		topLeft,
-		Vec2<int>{cellSizePixels},
-		Vec2<int>{0, 0},
-		0,
+	RaylibCpp::DrawTextureRec(
+		atlases.cellAtlasTexture,
+		atlases.GetSprite(SPRITE_TABLE[outcome][GetSpriteKey(cellIndex, overlayKey)]),
+		GetCellScreenPosition(cellIndex),
 		WHITE
 	);
 }
-
-void Board::Cell::Reset()
-{
-	isOpen = false;
-	hasMine = false;
-	hasExplodedMine = false;
-	isHighlighted = false;
-	isFlagged = false;
-	isPreviewingChord = false;
-	isPreviewingClick = false;
-	minesAdjacent = 0;
-	// An alternative is to not reset adjacentCells and add extra checks to Board::GenerateBoardLayout(),
-	// so that we don't do extra processing to find adjacent cells, but that would make the generation code more unreadable
-	adjacentCells = {};
-}
-
-
-//	#####################
-//	# Private functions #
-//	#####################
-
-
-Rectangle Board::Cell::GetCellSprite(const bool& isGameWon, const bool& isGameLost) const
-{
-	if (isGameWon)
-	{
-		if (!isOpen && !isFlagged)
-		{
-			return BoardSprite::FLAGGED;
-		}
-	}
-
-	if (isGameLost)
-	{
-		if (isFlagged && !hasMine)
-		{
-			return BoardSprite::FLAGGED_WRONG;
-		}
-
-		if (hasMine)
-		{
-			if (hasExplodedMine)
-			{
-				return BoardSprite::EXPLODED_MINE;
-			}
-
-			return BoardSprite::MINE;
-		}
-	}
-
-	if (!isOpen)
-	{
-		if (isPreviewingChord || isPreviewingClick)
-		{
-			return BoardSprite::OPEN_EMPTY;
-		}
-
-		if (isFlagged)
-		{
-			if (isHighlighted && !isGameWon)
-			{
-				return BoardSprite::FLAGGED_HIGHLIGHTED;
-			}
-
-			return BoardSprite::FLAGGED;
-		}
-
-		if (isHighlighted && !isGameLost)
-		{
-			return BoardSprite::CLOSED_HIGHLIGHTED;
-		}
-	}
-	else
-	{
-		switch (minesAdjacent)
-		{
-		case 1:
-			return BoardSprite::OPEN_1;
-		case 2:
-			return BoardSprite::OPEN_2;
-		case 3:
-			return BoardSprite::OPEN_3;
-		case 4:
-			return BoardSprite::OPEN_4;
-		case 5:
-			return BoardSprite::OPEN_5;
-		case 6:
-			return BoardSprite::OPEN_6;
-		case 7:
-			return BoardSprite::OPEN_7;
-		case 8:
-			return BoardSprite::OPEN_8;
-		default:
-			return BoardSprite::OPEN_EMPTY;
-		}
-	}
-
-	return BoardSprite::CLOSED;
-}
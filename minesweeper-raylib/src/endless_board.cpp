@@ -0,0 +1,525 @@
+#include "i_observers.h"
+
+#include "board.h"
+#include "endless_board.h"
+#include "resources_singleton.h"
+#include "settings.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+
+#if defined DEBUG
+#include <iostream>
+#endif
+
+namespace
+{
+	// Integer division that rounds towards negative infinity, so that cell -1 ends up in chunk -1 and not in chunk 0
+	int FloorDivide(const int value, const int divisor)
+	{
+		const int quotient = value / divisor;
+		return value % divisor < 0 ? quotient - 1 : quotient;
+	}
+}
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+EndlessBoard::EndlessBoard(const Vec2<int> screenPos,
+                           const int cellSize,
+                           const int viewWidthCells,
+                           const int viewHeightCells,
+                           const double mineDensity)
+	: AGameObject(screenPos, cellSize),
+	  chunks(std::make_unique<Chunk[]>(MAX_CHUNKS)),
+	  chunkSlots(CHUNK_SLOTS),
+	  viewSizeCells(viewWidthCells, viewHeightCells),
+	  mineDensity(mineDensity)
+{
+	assert(viewSizeCells.x > 0 && viewSizeCells.y > 0 && "The view width or height cannot be smaller than 1");
+	assert(cellSizePixels > 0 && "The board cell size cannot be smaller than 1");
+
+	revealStack.reserve(REVEAL_STACK_CAPACITY);
+}
+
+EndlessBoard::~EndlessBoard()
+{
+	while (!observers.empty())
+	{
+		EndlessBoard::Detach(observers.front());
+	}
+}
+
+void EndlessBoard::Update()
+{
+	MoveCamera();
+
+	isMouseOnBoard = false;
+	isPreviewingClick = false;
+	isPreviewingChord = false;
+
+	if (!IsCursorOnScreen())
+	{
+		return;
+	}
+
+	// Like on the regular board, the button changes are handled in order and the current state comes last
+	for (const MouseState& mouseState : InputQueue::GetInstance().GetMouseStates())
+	{
+		isMouseOnBoard = false;
+		isPreviewingClick = false;
+		isPreviewingChord = false;
+
+		const Vec2<int> mousePos = mouseState.position - screenPositionPixels;
+
+		// Check if the mouse is within the board area
+		if (mousePos.x <= 0 || mousePos.x >= viewSizeCells.x * cellSizePixels
+			|| mousePos.y <= 0 || mousePos.y >= viewSizeCells.y * cellSizePixels)
+		{
+			continue;
+		}
+
+		isMouseOnBoard = true;
+		mouseSelectedCell = viewOriginCells + Vec2<int>{mousePos.x / cellSizePixels, mousePos.y / cellSizePixels};
+
+		ProcessInput(mouseState);
+	}
+}
+
+void EndlessBoard::Draw() const
+{
+	using namespace BoardSprite;
+
+	const bool isGameLost = boardState == GAME_LOST;
+	const Outcome outcome = isGameLost ? BoardSprite::LOST : BoardSprite::IN_PROGRESS;
+	const ResourcesSingleton::ScaledAtlases& atlases = ResourcesSingleton::GetInstance().GetScaledAtlases(cellSizePixels);
+
+	for (int y = 0; y < viewSizeCells.y; ++y)
+	{
+		for (int x = 0; x < viewSizeCells.x; ++x)
+		{
+			const Vec2<int> cellPosition = viewOriginCells + Vec2<int>{x, y};
+
+			const uint8_t cell = GetCellState(cellPosition);
+
+			// Same sprite keys as the regular board, built on the fly since the cells don't store them.
+			// The mines are only shown once the game is lost, so they only need to be hashed then
+			uint8_t spriteKey;
+			if (cell & CELL_OPEN)
+			{
+				spriteKey = KEY_OPEN + (cell & ADJACENT_MINES_MASK);
+			}
+			else
+			{
+				const bool isSelected = isMouseOnBoard && cellPosition == mouseSelectedCell;
+				const bool isPressed = (isSelected && isPreviewingClick)
+					|| (isPreviewingChord
+						&& !(cell & CELL_FLAGGED)
+						&& std::abs(cellPosition.x - mouseSelectedCell.x) <= 1
+						&& std::abs(cellPosition.y - mouseSelectedCell.y) <= 1);
+
+				spriteKey = (cell & CELL_FLAGGED ? KEY_FLAGGED : 0)
+					| (isGameLost && mines.HasMine(cellPosition) ? KEY_MINE : 0)
+					| (cell & CELL_EXPLODED ? KEY_EXPLODED : 0)
+					| (isSelected ? KEY_HIGHLIGHTED : 0)
+					| (isPressed ? KEY_PRESSED : 0);
+			}
+
+			RaylibCpp::DrawTextureRec(
+				atlases.cellAtlasTexture,
+				atlases.GetSprite(SPRITE_TABLE[outcome][spriteKey]),
+				screenPositionPixels + Vec2<int>{x, y} * cellSizePixels,
+				WHITE
+			);
+		}
+	}
+}
+
+void EndlessBoard::Reset()
+{
+	std::ranges::fill(chunkSlots, ChunkSlot{});
+	chunksAmount = 0;
+	boardState = LAYOUT_UNINITIALIZED;
+	mines = MineHash{};
+	cameraPositionCells = {0, 0};
+	viewOriginCells = {0, 0};
+	flagsPlaced = 0;
+}
+
+void EndlessBoard::Attach(IObserver* observer)
+{
+	observers.push_back(observer);
+}
+
+void EndlessBoard::Detach(IObserver* observer)
+{
+	observers.remove(observer);
+}
+
+void EndlessBoard::NotifyFlagToggleObservers()
+{
+	for (IObserver* observer : observers)
+	{
+		if (auto* specificObserver = dynamic_cast<IObserverFlagToggle*>(observer); specificObserver != nullptr)
+		{
+			specificObserver->OnToggledCellFlag(flagsPlaced);
+		}
+	}
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+void EndlessBoard::NotifyGameStartObservers()
+{
+	for (IObserver* observer : observers)
+	{
+		if (auto* specificObserver = dynamic_cast<IObserverGameStart*>(observer); specificObserver != nullptr)
+		{
+			specificObserver->OnGameStarted();
+		}
+	}
+}
+
+void EndlessBoard::NotifyBoardMouseButtonDownObservers()
+{
+	for (IObserver* observer : observers)
+	{
+		if (auto* specificObserver = dynamic_cast<IObserverBoardMouseButtonDown*>(observer); specificObserver != nullptr)
+		{
+			specificObserver->OnBoardMouseButtonDown();
+		}
+	}
+}
+
+void EndlessBoard::NotifyGameLostObservers()
+{
+	for (IObserver* observer : observers)
+	{
+		if (auto* specificObserver = dynamic_cast<IObserverGameLost*>(observer); specificObserver != nullptr)
+		{
+			specificObserver->OnGameLost();
+		}
+	}
+}
+
+void EndlessBoard::MoveCamera()
+{
+	Vector2 direction{0, 0};
+	direction.x -= IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A) ? 1.0f : 0.0f;
+	direction.x += IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D) ? 1.0f : 0.0f;
+	direction.y -= IsKeyDown(KEY_UP) || IsKeyDown(KEY_W) ? 1.0f : 0.0f;
+	direction.y += IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S) ? 1.0f : 0.0f;
+
+	if (direction.x == 0 && direction.y == 0)
+	{
+		return;
+	}
+
+	const float distance = Settings::ENDLESS_CAMERA_SPEED_CELLS * GetFrameTime();
+	cameraPositionCells.x += direction.x * distance;
+	cameraPositionCells.y += direction.y * distance;
+
+	// Moving the view doesn't create any chunks, cells that were never touched are drawn without one
+	viewOriginCells = Vec2<int>{
+		static_cast<int>(std::floor(cameraPositionCells.x)),
+		static_cast<int>(std::floor(cameraPositionCells.y))
+	};
+}
+
+void EndlessBoard::ProcessInput(const MouseState& mouseState)
+{
+	if (boardState == GAME_LOST)
+	{
+		return;
+	}
+
+	const uint8_t selectedCell = GetCellState(mouseSelectedCell);
+
+	// Chording
+	if ((mouseState.IsButtonDown(RaylibCpp::MOUSE_LEFT_CLICK) && mouseState.IsButtonReleased(RaylibCpp::MOUSE_RIGHT_CLICK))
+		|| (mouseState.IsButtonDown(RaylibCpp::MOUSE_RIGHT_CLICK) && mouseState.IsButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK))
+		|| mouseState.IsButtonReleased(RaylibCpp::MOUSE_MIDDLE_CLICK))
+	{
+		ChordCell(mouseSelectedCell);
+	}
+	// Preview chorded cells
+	else if ((mouseState.IsButtonDown(RaylibCpp::MOUSE_LEFT_CLICK) && mouseState.IsButtonDown(RaylibCpp::MOUSE_RIGHT_CLICK))
+		|| mouseState.IsButtonDown(RaylibCpp::MOUSE_MIDDLE_CLICK))
+	{
+		isPreviewingChord = true;
+		isPreviewingClick = true;
+		NotifyBoardMouseButtonDownObservers();
+	}
+	// Revealing a cell
+	else if (mouseState.IsButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK))
+	{
+		if (selectedCell & CELL_FLAGGED)
+		{
+			return;
+		}
+
+		if (boardState == LAYOUT_UNINITIALIZED)
+		{
+			StartGame(mouseSelectedCell);
+		}
+
+		OpenCell(mouseSelectedCell);
+	}
+	// Preview click
+	else if (mouseState.IsButtonDown(RaylibCpp::MOUSE_LEFT_CLICK))
+	{
+		if (selectedCell & CELL_FLAGGED)
+		{
+			return;
+		}
+
+		isPreviewingClick = true;
+		NotifyBoardMouseButtonDownObservers();
+	}
+	// Flagging a cell
+	else if (mouseState.IsButtonReleased(RaylibCpp::MOUSE_RIGHT_CLICK))
+	{
+		ToggleFlag(mouseSelectedCell);
+	}
+}
+
+// The seed is only picked on the first click, and the first clicked cell and its neighbors never have mines.
+// Nothing is generated, the mine hash just starts answering with the new seed
+void EndlessBoard::StartGame(const Vec2<int>& firstCell)
+{
+	const auto seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+	mines = MineHash{seed, mineDensity, firstCell};
+
+	boardState = IN_PROGRESS;
+	NotifyGameStartObservers();
+}
+
+void EndlessBoard::OpenCell(const Vec2<int>& cellPosition)
+{
+	if (GetCellState(cellPosition) & (CELL_OPEN | CELL_FLAGGED))
+	{
+		return;
+	}
+
+	if (mines.HasMine(cellPosition))
+	{
+		if (uint8_t* cell = GetCell(cellPosition); cell != nullptr)
+		{
+			*cell |= CELL_EXPLODED;
+		}
+
+		LoseGame();
+
+		return;
+	}
+
+	RevealCells(cellPosition);
+}
+
+// Flood fills from the given cell like the regular board does. The flood fill isn't limited to a chunk,
+// chunks are only created for the cells it actually opens.
+// The stack never grows. A cell that doesn't fit is still opened, and once the stack runs empty, every chunk is looked
+// through for open cells without mines around them, which opens the neighbors of the cells that were left out.
+// That's slow, but only a reveal of a large part of the pool ever gets that far
+void EndlessBoard::RevealCells(const Vec2<int>& startCell)
+{
+	const auto openCell = [this](const Vec2<int>& cellPosition)
+	{
+		if ((this->GetCellState(cellPosition) & (CELL_OPEN | CELL_FLAGGED)) || this->mines.HasMine(cellPosition))
+		{
+			return;
+		}
+
+		uint8_t* cell = this->GetCell(cellPosition);
+		if (cell == nullptr)
+		{
+			return;
+		}
+
+		*cell |= static_cast<uint8_t>(CELL_OPEN | this->CountAdjacentMines(cellPosition));
+
+		if (this->revealStack.size() == REVEAL_STACK_CAPACITY)
+		{
+			this->isRevealStackOverflowed = true;
+			return;
+		}
+
+		this->revealStack.push_back(cellPosition);
+	};
+
+	openCell(startCell);
+
+	while (!revealStack.empty() || isRevealStackOverflowed)
+	{
+		if (revealStack.empty())
+		{
+			isRevealStackOverflowed = false;
+
+			// Opening cells can add chunks, which the loop gets to as well
+			for (size_t chunkIndex = 0; chunkIndex < chunksAmount; ++chunkIndex)
+			{
+				const Vec2<int> chunkOrigin = chunks[chunkIndex].coordinate * CHUNK_SIZE;
+				for (int indexInChunk = 0; indexInChunk < CHUNK_CELLS; ++indexInChunk)
+				{
+					const uint8_t cell = chunks[chunkIndex].cells[indexInChunk];
+					if ((cell & CELL_OPEN) && (cell & ADJACENT_MINES_MASK) == 0)
+					{
+						ProcessCellNeighbors(chunkOrigin + Vec2<int>{indexInChunk % CHUNK_SIZE, indexInChunk / CHUNK_SIZE}, openCell);
+					}
+				}
+			}
+			continue;
+		}
+
+		const Vec2<int> cellPosition = revealStack.back();
+		revealStack.pop_back();
+
+		// Numbered cells are the edge of the revealed area
+		if ((GetCellState(cellPosition) & ADJACENT_MINES_MASK) == 0)
+		{
+			ProcessCellNeighbors(cellPosition, openCell);
+		}
+	}
+}
+
+void EndlessBoard::ChordCell(const Vec2<int>& cellPosition)
+{
+	const uint8_t cell = GetCellState(cellPosition);
+	if (!(cell & CELL_OPEN))
+	{
+		return;
+	}
+
+	int flaggedAdjacentCells = 0;
+	const auto countAdjacentFlags = [&flaggedAdjacentCells, this](const Vec2<int>& adjacentCellPosition)
+	{
+		flaggedAdjacentCells += (this->GetCellState(adjacentCellPosition) & CELL_FLAGGED) != 0;
+	};
+	ProcessCellNeighbors(cellPosition, countAdjacentFlags);
+
+	if (flaggedAdjacentCells == 0 || flaggedAdjacentCells != (cell & ADJACENT_MINES_MASK))
+	{
+		return;
+	}
+
+	const auto openAdjacentCell = [this](const Vec2<int>& adjacentCellPosition)
+	{
+		if (this->IsGameInProgress())
+		{
+			this->OpenCell(adjacentCellPosition);
+		}
+	};
+	ProcessCellNeighbors(cellPosition, openAdjacentCell);
+}
+
+void EndlessBoard::ToggleFlag(const Vec2<int>& cellPosition)
+{
+	uint8_t* cell = GetCell(cellPosition);
+	if (cell == nullptr || (*cell & CELL_OPEN))
+	{
+		return;
+	}
+
+	*cell ^= CELL_FLAGGED;
+	flagsPlaced += *cell & CELL_FLAGGED ? 1 : -1;
+
+	NotifyFlagToggleObservers();
+}
+
+void EndlessBoard::LoseGame()
+{
+	boardState = GAME_LOST;
+
+	NotifyGameLostObservers();
+
+#if defined DEBUG
+	std::cout << "GAME LOST! Explored chunks: " << chunksAmount << "\n";
+#endif
+}
+
+Vec2<int> EndlessBoard::GetChunkCoordinate(const Vec2<int>& cellPosition)
+{
+	return Vec2<int>{FloorDivide(cellPosition.x, CHUNK_SIZE), FloorDivide(cellPosition.y, CHUNK_SIZE)};
+}
+
+int EndlessBoard::GetIndexInChunk(const Vec2<int>& cellPosition)
+{
+	const Vec2<int> chunkOrigin = GetChunkCoordinate(cellPosition) * CHUNK_SIZE;
+	return (cellPosition.y - chunkOrigin.y) * CHUNK_SIZE + (cellPosition.x - chunkOrigin.x);
+}
+
+size_t EndlessBoard::GetHomeChunkSlot(const Vec2<int>& chunkCoordinate)
+{
+	return static_cast<size_t>(MineHash::HashCoordinate(0, chunkCoordinate)) & (CHUNK_SLOTS - 1);
+}
+
+size_t EndlessBoard::FindChunkSlot(const Vec2<int>& chunkCoordinate) const
+{
+	size_t slot = GetHomeChunkSlot(chunkCoordinate);
+
+	while (chunkSlots[slot].chunkIndex != NO_CHUNK && chunkSlots[slot].coordinate != chunkCoordinate)
+	{
+		slot = (slot + 1) & (CHUNK_SLOTS - 1);
+	}
+
+	return slot;
+}
+
+// Chunks are never removed until the board is reset, so the table only ever has to add them
+EndlessBoard::Chunk* EndlessBoard::GetOrCreateChunk(const Vec2<int>& chunkCoordinate)
+{
+	ChunkSlot& slot = chunkSlots[FindChunkSlot(chunkCoordinate)];
+	if (slot.chunkIndex != NO_CHUNK)
+	{
+		return &chunks[slot.chunkIndex];
+	}
+
+	if (chunksAmount == MAX_CHUNKS)
+	{
+		return nullptr;
+	}
+
+	slot = ChunkSlot{chunkCoordinate, chunksAmount};
+	chunks[chunksAmount] = Chunk{chunkCoordinate};
+
+	return &chunks[chunksAmount++];
+}
+
+uint8_t* EndlessBoard::GetCell(const Vec2<int>& cellPosition)
+{
+	Chunk* chunk = GetOrCreateChunk(GetChunkCoordinate(cellPosition));
+
+	return chunk != nullptr ? &chunk->cells[GetIndexInChunk(cellPosition)] : nullptr;
+}
+
+uint8_t EndlessBoard::GetCellState(const Vec2<int>& cellPosition) const
+{
+	const ChunkSlot& slot = chunkSlots[FindChunkSlot(GetChunkCoordinate(cellPosition))];
+	if (slot.chunkIndex == NO_CHUNK)
+	{
+		return 0;
+	}
+
+	return chunks[slot.chunkIndex].cells[GetIndexInChunk(cellPosition)];
+}
+
+uint8_t EndlessBoard::CountAdjacentMines(const Vec2<int>& cellPosition) const
+{
+	uint8_t adjacentMines = 0;
+	const auto countMine = [&adjacentMines, this](const Vec2<int>& adjacentCellPosition)
+	{
+		adjacentMines += this->mines.HasMine(adjacentCellPosition);
+	};
+	ProcessCellNeighbors(cellPosition, countMine);
+
+	return adjacentMines;
+}
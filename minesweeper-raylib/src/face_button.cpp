@@ -10,9 +10,7 @@
 
 
 FaceButton::FaceButton(const Vec2<int>& screenPos, const int& cellSize)
-	: AGameObject(screenPos, cellSize),
-	  widthPixels(2 * cellSize),
-	  heightPixels(2 * cellSize)
+	: AGameObject(screenPos, cellSize)
 {
 }
 
@@ -23,32 +21,31 @@ void FaceButton::Update()
 		return;
 	}
 
-	ResetFaceButtonSpriteState();
+	for (const MouseState& mouseState : InputQueue::GetInstance().GetMouseStates())
+	{
+		ResetFaceButtonSpriteState();
 
-	auto [mouseX, mouseY] = GetMousePosition();
-	const Vec2<int> mousePos =
-		Vec2<int>(static_cast<int>(mouseX), static_cast<int>(mouseY))
-		- screenPositionPixels;
+		const Vec2<int> mousePos = mouseState.position - screenPositionPixels;
 
-	// Check if the mouse is within the face button area
-	if (mousePos.x <= 0 || mousePos.x >= widthPixels
-		|| mousePos.y <= 0 || mousePos.y >= heightPixels)
-	{
-		return;
-	}
+		// Check if the mouse is within the face button area
+		if (mousePos.x <= 0 || mousePos.x >= GetSizePixels()
+			|| mousePos.y <= 0 || mousePos.y >= GetSizePixels())
+		{
+			continue;
+		}
 
-	ProcessInput();
+		ProcessInput(mouseState);
+	}
 }
 
 void FaceButton::Draw() const
 {
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetFaceAtlasTexture(),
-		GetFaceSprite(),
+	const ResourcesSingleton::ScaledAtlases& atlases = ResourcesSingleton::GetInstance().GetScaledAtlases(cellSizePixels);
+
+	RaylibCpp::DrawTextureRec(
+		atlases.faceAtlasTexture,
+		atlases.GetSprite(GetFaceSprite()),
 		screenPositionPixels,
-		Vec2<int>{widthPixels, heightPixels},
-		Vec2<int>{0, 0},
-		0,
 		WHITE
 	);
 }
@@ -92,13 +89,13 @@ void FaceButton::ResetFaceButtonSpriteState()
 	}
 }
 
-void FaceButton::ProcessInput()
+void FaceButton::ProcessInput(const MouseState& mouseState)
 {
-	if (IsMouseButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK))
+	if (mouseState.IsButtonReleased(RaylibCpp::MOUSE_LEFT_CLICK))
 	{
 		NotifyGameRestartObservers();
 	}
-	else if (IsMouseButtonDown(RaylibCpp::MOUSE_LEFT_CLICK))
+	else if (mouseState.IsButtonDown(RaylibCpp::MOUSE_LEFT_CLICK))
 	{
 		if (faceButtonState != OPEN_SMILE)
 		{
@@ -109,21 +106,7 @@ void FaceButton::ProcessInput()
 
 Rectangle FaceButton::GetFaceSprite() const
 {
-	switch (faceButtonState)
-	{
-	case CLOSED_SMILE:
-		return FaceSprite::CLOSED_SMILE;
-	case OPEN_SMILE:
-		return FaceSprite::OPEN_SMILE;
-	case SURPRISED:
-		return FaceSprite::SURPRISED;
-	case DEAD:
-		return FaceSprite::DEAD;
-	case COOL:
-		return FaceSprite::COOL;
-	}
-
-	return FaceSprite::CLOSED_SMILE;
+	return FaceSprite::SPRITE_TABLE[faceButtonState];
 }
 
 void FaceButton::NotifyGameRestartObservers()
@@ -23,41 +23,34 @@ void FlagCounter::Update()
 
 void FlagCounter::Draw() const
 {
+	const ResourcesSingleton::ScaledAtlases& atlases = ResourcesSingleton::GetInstance().GetScaledAtlases(cellSizePixels);
+
 	const int hundreds = unflaggedMines >= 0
-		                     ? unflaggedMines / 100 % 10
+		                     ? static_cast<int>(unflaggedMines / 100 % 10)
 		                     : 11; // Dash location in the atlas texture
 
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetDigitsAtlasTexture(),
-		Settings::GetDigitSprite(hundreds),
+	RaylibCpp::DrawTextureRec(
+		atlases.digitsAtlasTexture,
+		atlases.GetSprite(Settings::GetDigitSprite(hundreds)),
 		screenPositionPixels,
-		Vec2<int>{cellSizePixels, cellSizePixels * 2},
-		Vec2<int>{0, 0},
-		0,
 		WHITE
 	);
 
-	const int tens = std::abs(unflaggedMines) / 10 % 10;
+	const int tens = static_cast<int>(std::abs(unflaggedMines) / 10 % 10);
 
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetDigitsAtlasTexture(),
-		Settings::GetDigitSprite(tens),
+	RaylibCpp::DrawTextureRec(
+		atlases.digitsAtlasTexture,
+		atlases.GetSprite(Settings::GetDigitSprite(tens)),
 		Vec2<int>{screenPositionPixels.x + cellSizePixels, screenPositionPixels.y},
-		Vec2<int>{cellSizePixels, cellSizePixels * 2},
-		Vec2<int>{0, 0},
-		0,
 		WHITE
 	);
 
-	const int ones = std::abs(unflaggedMines) % 10;
+	const int ones = static_cast<int>(std::abs(unflaggedMines) % 10);
 
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetDigitsAtlasTexture(),
-		Settings::GetDigitSprite(ones),
+	RaylibCpp::DrawTextureRec(
+		atlases.digitsAtlasTexture,
+		atlases.GetSprite(Settings::GetDigitSprite(ones)),
 		Vec2<int>{screenPositionPixels.x + cellSizePixels * 2, screenPositionPixels.y},
-		Vec2<int>{cellSizePixels, cellSizePixels * 2},
-		Vec2<int>{0, 0},
-		0,
 		WHITE
 	);
 }
@@ -73,7 +66,7 @@ void FlagCounter::Reset()
 //	#####################
 
 
-void FlagCounter::OnToggledCellFlag(const int& minesLeftToFlag)
+void FlagCounter::OnToggledCellFlag(const int64_t& minesLeftToFlag)
 {
 	this->unflaggedMines = minesLeftToFlag;
 }
@@ -1,7 +1,9 @@
 #include "game.h"
-#include "raylib_cpp.h"
+#include "allocation_tracker.h"
+#include "input_queue.h"
 #include "resources_singleton.h"
 
+#include <algorithm>
 #include <cassert>
 #if defined DEBUG
 #include <iostream>
@@ -12,52 +14,101 @@ using namespace Settings;
 Game::Game(const int fps,
            const std::string& title,
            const int cellSize,
-           const int boardWidth,
-           const int boardHeight,
-           const int maxMinesAmount)
-	: cellSizePixels(cellSize),
+           const size_t boardWidth,
+           const size_t boardHeight,
+           const uint64_t maxMinesAmount,
+           const bool autoChord,
+           const bool endless,
+           const double endlessMineDensity,
+           const bool vsync,
+           const bool latencyProfiling,
+           const bool threadedSimulation,
+           const std::string& sharedBoardName,
+           const int sessionsAmount)
+	: frameDurationSeconds(1.0 / fps),
+	  cellSizePixels(cellSize),
 	  borderThicknessPixels(cellSize / 2),
-	  boardWidthCells(boardWidth),
-	  boardHeightCells(boardHeight),
-
-	  board(GetBoardScreenPosition(cellSizePixels, borderThicknessPixels),
-	        cellSizePixels,
-	        boardWidthCells,
-	        boardHeightCells,
-	        maxMinesAmount),
-	  flagCounter(GetFlagCounterScreenPosition(cellSizePixels), cellSizePixels),
-	  faceButton(GetFaceButtonScreenPosition(cellSizePixels, borderThicknessPixels, boardWidth), cellSizePixels),
-	  timer(GetTimerScreenPosition(cellSizePixels, boardWidth), cellSizePixels)
+	  boardWidthCells(static_cast<int>(std::min(boardWidth, static_cast<size_t>(MAX_LAYOUT_BOARD_DIMENSION_CELLS)))),
+	  boardHeightCells(static_cast<int>(std::min(boardHeight, static_cast<size_t>(MAX_LAYOUT_BOARD_DIMENSION_CELLS))))
 {
-	assert(!GetWindowHandle() && "Cannot initialize window, since window is already open");
+	assert(sessionsAmount > 0 && sessionsAmount <= MAX_SPLIT_SCREEN_SESSIONS && "Invalid amount of game sessions");
+
+	const Vec2<int> sessionSize = GetWindowSize(cellSizePixels, borderThicknessPixels, boardWidthCells, boardHeightCells);
+
+	sessions.reserve(static_cast<size_t>(sessionsAmount));
+	for (int i = 0; i < sessionsAmount; ++i)
+	{
+		// Every session shares its own board, bots tell them apart by the number after the name
+		const std::string sessionSharedBoardName = sharedBoardName.empty() || sessionsAmount == 1
+			                                           ? sharedBoardName
+			                                           : sharedBoardName + std::to_string(i);
+
+		sessions.push_back(std::make_unique<GameSession>(GetSessionScreenPosition(i, sessionsAmount, sessionSize),
+		                                                 cellSizePixels,
+		                                                 boardWidth,
+		                                                 boardHeight,
+		                                                 maxMinesAmount,
+		                                                 autoChord,
+		                                                 endless,
+		                                                 endlessMineDensity,
+		                                                 threadedSimulation,
+		                                                 sessionSharedBoardName));
+	}
+
+	// Latency is only measured on the regular board, since that's where the cell changes are tracked
+	if (latencyProfiling && !endless)
+	{
+		latencyProfiler = std::make_unique<LatencyProfiler>(sessions.front()->GetBoardScreenPosition(),
+		                                                    cellSizePixels,
+		                                                    std::string("vsync ") + (vsync ? "on" : "off")
+		                                                    + ", " + std::to_string(fps) + " FPS");
+	}
 
-	// Initialize window
-	SetTargetFPS(fps);
+	assert(!GetWindowHandle() && "Cannot initialize window, since window is already open");
 
-	const int windowWidth = boardWidthCells * cellSizePixels + cellSizePixels;
-	const int windowHeight = boardHeightCells * cellSizePixels + cellSizePixels * 4 + borderThicknessPixels;
+	// Initialize window, the frame rate isn't handed to raylib, since the frames are paced by the input sampling
+	SetConfigFlags(vsync ? FLAG_WINDOW_RESIZABLE | FLAG_VSYNC_HINT : FLAG_WINDOW_RESIZABLE);
 
-	InitWindow(windowWidth, windowHeight, title.c_str());
+	const Vec2<int> sessionGridSize = GetSessionGridSize(sessionsAmount);
+	const Vec2<int> windowSize = sessionSize * sessionGridSize;
 
-	const Image gameIcon = LoadImage("resources/icon.png");
-	SetWindowIcon(gameIcon);
+	InitWindow(windowSize.x, windowSize.y, title.c_str());
 
-	// Setup events
-	board.Attach(&flagCounter);
-	board.Attach(&faceButton);
-	board.Attach(&timer);
-	board.Attach(this); // For winning/losing the game
+	const Vec2<int> minWindowSize = GetWindowSize(MIN_RESIZED_CELL_SIZE_PIXELS,
+	                                              MIN_RESIZED_CELL_SIZE_PIXELS / 2,
+	                                              boardWidthCells,
+	                                              boardHeightCells) * sessionGridSize;
+	SetWindowMinSize(minWindowSize.x, minWindowSize.y);
+	SetWindowIcon(ResourcesSingleton::GetIconImage());
+	windowScaleDpi = GetWindowScaleDPI();
 
-	// We need to make sure that flagCounter is attached to board,
-	// so that the initial notification can trigger successfully once the board object is constructed
-	board.NotifyFlagToggleObservers();
+	// A grid of sessions at the configured cell size easily gets larger than the monitor, so it's shrunk to fit,
+	// but never below the smallest cell size, since the sessions wouldn't fit into the window anymore
+	if (sessionsAmount > 1)
+	{
+		const int monitor = GetCurrentMonitor();
+		const Vec2<int> monitorSize{GetMonitorWidth(monitor), GetMonitorHeight(monitor)};
 
-	faceButton.Attach(this); // For restarting the game
+		if (monitorSize.x > 0 && monitorSize.y > 0 && (windowSize.x > monitorSize.x || windowSize.y > monitorSize.y))
+		{
+			SetWindowSize(std::clamp(monitorSize.x, minWindowSize.x, windowSize.x),
+			              std::clamp(monitorSize.y, minWindowSize.y, windowSize.y));
+			UpdateLayout();
+		}
+	}
 }
 
 Game::~Game() noexcept
 {
 	assert(GetWindowHandle() && "Cannot close window, since window is already closed");
+
+	if (latencyProfiler != nullptr && !latencyProfiler->WriteHistogram(LATENCY_HISTOGRAM_FILE_PATH))
+	{
+#if defined DEBUG
+		std::cout << "Could not write the latency histogram\n";
+#endif
+	}
+
 	CloseWindow();
 }
 
@@ -68,78 +119,138 @@ bool Game::GameShouldClose() const
 
 void Game::Tick()
 {
+#if defined DEBUG
+	const bool wasEveryGameInProgress = IsEveryGameInProgress();
+	const size_t allocationsBeforeTick = AllocationTracker::GetAllocationCount();
+#endif
+
+	InputQueue& input = InputQueue::GetInstance();
+	input.BeginFrame();
+
+	// A DPI change (e.g. moving the window to another monitor) doesn't always come with a resize event
+	if (const Vector2 currentScaleDpi = GetWindowScaleDPI();
+		input.IsWindowResized() || currentScaleDpi.x != windowScaleDpi.x || currentScaleDpi.y != windowScaleDpi.y)
+	{
+		windowScaleDpi = currentScaleDpi;
+		UpdateLayout();
+	}
+
 	BeginDrawing();
 	Update();
 	Draw();
 	EndDrawing();
+
+	// EndDrawing has handed the frame over to be presented, which is as close to the screen as raylib can see
+	if (latencyProfiler != nullptr)
+	{
+		for (const std::unique_ptr<GameSession>& session : sessions)
+		{
+			if (const double inputTime = session->TakeChangingInputTime(); inputTime != Board::NO_INPUT_TIME)
+			{
+				latencyProfiler->RecordLatency(GetTime() - inputTime);
+			}
+		}
+	}
+
+	input.EndFrame();
+
+#if defined DEBUG
+	// GetTime() counts from InitWindow()
+	if (!hasPresentedFirstFrame)
+	{
+		hasPresentedFirstFrame = true;
+		std::cout << "Time to first frame: " << GetTime() * 1000.0 << " ms\n";
+	}
+
+	// Generating, winning, losing and restarting are allowed to allocate, but the frames in between them are not.
+	// With split screen sessions, only frames in which none of them did any of that are checked
+	assert((!wasEveryGameInProgress
+			|| !IsEveryGameInProgress()
+			|| AllocationTracker::GetAllocationCount() == allocationsBeforeTick)
+		&& "A frame of a game in progress allocated heap memory");
+#endif
+
+	// A frame that ran late doesn't make the next ones hurry to catch up
+	nextFrameTime = std::max(nextFrameTime + frameDurationSeconds, GetTime());
+	input.WaitForNextFrame(nextFrameTime);
+}
+
+bool Game::IsEveryGameInProgress() const
+{
+	return std::ranges::all_of(sessions, [](const std::unique_ptr<GameSession>& session)
+	{
+		return session->IsGameInProgress();
+	});
 }
 
 void Game::Update()
 {
-	faceButton.Update();
+	// The keyboard goes to the session under the mouse, so that shortcuts only ever change one game
+	const std::span<const MouseState> mouseStates = InputQueue::GetInstance().GetMouseStates();
+	const Vec2<int> mousePosition = mouseStates.empty() ? Vec2<int>{-1} : mouseStates.back().position;
 
-	if (isGameWon || isGameLost)
+	for (const std::unique_ptr<GameSession>& session : sessions)
 	{
-		return;
+		session->Update(sessions.size() == 1 || session->ContainsPoint(mousePosition));
 	}
 
-	board.Update();
-	timer.Update();
+	if (latencyProfiler != nullptr)
+	{
+		latencyProfiler->Update();
+	}
 }
 
+// Each layer is drawn for every session before the next one, so that consecutive draws use the same texture,
+// which raylib batches into one draw call. The amount of draw calls doesn't grow with the amount of sessions,
+// except for the minimaps, which each have a texture of their own
 void Game::Draw() const
 {
 	ClearBackground(Color{50, 50, 50, 255});
 
-	// Draw borders
-	RaylibCpp::DrawRectangleLinesEx(
-		Vec2<int>{0},
-		Vec2{
-			boardWidthCells * cellSizePixels,
-			boardHeightCells * cellSizePixels + cellSizePixels * 3 + borderThicknessPixels
-		} + cellSizePixels,
-		borderThicknessPixels,
-		DARKGRAY
-	);
-	RaylibCpp::DrawLineEx(
-		Vec2<int>{borderThicknessPixels, cellSizePixels * 4 - borderThicknessPixels / 2},
-		Vec2<int>{
-			boardWidthCells * cellSizePixels + borderThicknessPixels,
-			cellSizePixels * 4 - borderThicknessPixels / 2
-		},
-		borderThicknessPixels,
-		DARKGRAY
-	);
-
-	board.Draw();
-	timer.Draw();
-	flagCounter.Draw();
-	faceButton.Draw();
+	for (uint8_t layer = 0; layer < GameSession::DRAW_LAYER_COUNT; ++layer)
+	{
+		for (const std::unique_ptr<GameSession>& session : sessions)
+		{
+			session->Draw(static_cast<GameSession::DrawLayer>(layer));
+		}
+	}
+
+	if (latencyProfiler != nullptr)
+	{
+		latencyProfiler->Draw();
+	}
 }
 
-void Game::OnGameRestarted()
+// Only the screen positions and the cell size change, the board model is left as is.
+// The scaled atlases are rebuilt lazily on the next draw, and only if the cell size actually changed.
+void Game::UpdateLayout()
 {
-	isGameWon = false;
-	isGameLost = false;
+	// Every session gets an equal share of the window
+	const int sessionsAmount = static_cast<int>(sessions.size());
+	const Vec2<int> sessionGridSize = GetSessionGridSize(sessionsAmount);
+	const Vec2<int> sessionSpacePixels{GetScreenWidth() / sessionGridSize.x, GetScreenHeight() / sessionGridSize.y};
 
-	board.Reset();
-	timer.Reset();
-	flagCounter.Reset();
-	faceButton.Reset();
+	const int newCellSizePixels = GetCellSizeToFitWindow(sessionSpacePixels, boardWidthCells, boardHeightCells);
+	if (newCellSizePixels == cellSizePixels)
+	{
+		return;
+	}
 
-	board.NotifyFlagToggleObservers();
+	cellSizePixels = newCellSizePixels;
+	borderThicknessPixels = newCellSizePixels / 2;
 
-#if defined DEBUG
-	std::cout << "GAME RESTARTED!\n";
-#endif
-}
+	const Vec2<int> sessionSize = GetWindowSize(cellSizePixels, borderThicknessPixels, boardWidthCells, boardHeightCells);
+	for (int i = 0; i < sessionsAmount; ++i)
+	{
+		sessions[static_cast<size_t>(i)]->SetLayout(GetSessionScreenPosition(i, sessionsAmount, sessionSize), cellSizePixels);
+	}
 
-void Game::OnGameWon()
-{
-	isGameWon = true;
-}
+	if (latencyProfiler != nullptr)
+	{
+		latencyProfiler->SetLayout(sessions.front()->GetBoardScreenPosition(), cellSizePixels);
+	}
 
-void Game::OnGameLost()
-{
-	isGameLost = true;
+#if defined DEBUG
+	std::cout << "Cell size changed to " << cellSizePixels << " pixels\n";
+#endif
 }
@@ -5,3 +5,9 @@ AGameObject::AGameObject(const Vec2<int>& screenPos, const int& cellSize)
 	  cellSizePixels(cellSize)
 {
 }
+
+void AGameObject::SetLayout(const Vec2<int>& screenPos, const int& cellSize)
+{
+	screenPositionPixels = screenPos;
+	cellSizePixels = cellSize;
+}
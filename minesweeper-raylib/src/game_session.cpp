@@ -0,0 +1,280 @@
+#include "game_session.h"
+#include "input_queue.h"
+#include "raylib_cpp.h"
+
+#include <algorithm>
+#if defined DEBUG
+#include <iostream>
+#endif
+
+using namespace Settings;
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+GameSession::GameSession(const Vec2<int> topLeftPixels,
+                         const int cellSize,
+                         const size_t boardWidth,
+                         const size_t boardHeight,
+                         const uint64_t maxMinesAmount,
+                         const bool autoChord,
+                         const bool endless,
+                         const double endlessMineDensity,
+                         const bool threadedSimulation,
+                         const std::string& sharedBoardName)
+	: topLeftPixels(topLeftPixels),
+	  cellSizePixels(cellSize),
+	  borderThicknessPixels(cellSize / 2),
+	  boardWidthCells(static_cast<int>(std::min(boardWidth, static_cast<size_t>(MAX_LAYOUT_BOARD_DIMENSION_CELLS)))),
+	  boardHeightCells(static_cast<int>(std::min(boardHeight, static_cast<size_t>(MAX_LAYOUT_BOARD_DIMENSION_CELLS)))),
+
+	  board(topLeftPixels + Settings::GetBoardScreenPosition(cellSizePixels, borderThicknessPixels),
+	        cellSizePixels,
+	        boardWidth,
+	        boardHeight,
+	        maxMinesAmount,
+	        autoChord,
+	        threadedSimulation && !endless,
+	        endless ? "" : sharedBoardName),
+	  flagCounter(topLeftPixels + GetFlagCounterScreenPosition(cellSizePixels), cellSizePixels),
+	  faceButton(topLeftPixels + GetFaceButtonScreenPosition(cellSizePixels, borderThicknessPixels, boardWidthCells), cellSizePixels),
+	  timer(topLeftPixels + GetTimerScreenPosition(cellSizePixels, boardWidthCells), cellSizePixels),
+	  minimap(topLeftPixels + GetMinimapScreenPosition(cellSizePixels),
+	          cellSizePixels,
+	          boardWidth,
+	          boardHeight,
+	          Vec2<int>{boardWidthCells, boardHeightCells})
+{
+	if (endless)
+	{
+		endlessBoard = std::make_unique<EndlessBoard>(GetBoardScreenPosition(),
+		                                              cellSizePixels,
+		                                              boardWidthCells,
+		                                              boardHeightCells,
+		                                              endlessMineDensity);
+	}
+
+	// Setup events
+	if (endlessBoard != nullptr)
+	{
+		endlessBoard->Attach(&flagCounter);
+		endlessBoard->Attach(&faceButton);
+		endlessBoard->Attach(&timer);
+		endlessBoard->Attach(this); // For losing the game, endless games can't be won
+		endlessBoard->NotifyFlagToggleObservers();
+	}
+	else
+	{
+		board.Attach(&flagCounter);
+		board.Attach(&faceButton);
+		board.Attach(&timer);
+		board.Attach(this); // For winning/losing the game, and loading saved games
+		board.Attach(&minimap);
+
+		// We need to make sure that flagCounter is attached to board,
+		// so that the initial notification can trigger successfully once the board object is constructed
+		board.NotifyFlagToggleObservers();
+	}
+
+	faceButton.Attach(this); // For restarting the game
+}
+
+void GameSession::Update(const bool& hasKeyboardFocus)
+{
+	// Saving, undoing and hints only work on the regular board
+	if (hasKeyboardFocus && endlessBoard == nullptr)
+	{
+		UpdateShortcuts();
+	}
+
+	faceButton.Update();
+
+	if (!isGameWon && !isGameLost)
+	{
+		if (endlessBoard != nullptr)
+		{
+			endlessBoard->Update();
+		}
+		else
+		{
+			board.Update();
+		}
+
+		timer.Update();
+	}
+
+	// Everything that could change cells this frame is done, so the minimap gets the frame's changes in one batch
+	if (endlessBoard == nullptr)
+	{
+		board.DispatchNotifications();
+		minimap.Update();
+	}
+}
+
+void GameSession::Draw(const DrawLayer& layer) const
+{
+	switch (layer)
+	{
+	case FRAME:
+		RaylibCpp::DrawRectangleLinesEx(
+			topLeftPixels,
+			Vec2{
+				boardWidthCells * cellSizePixels,
+				boardHeightCells * cellSizePixels + cellSizePixels * 3 + borderThicknessPixels
+			} + cellSizePixels,
+			borderThicknessPixels,
+			DARKGRAY
+		);
+		RaylibCpp::DrawLineEx(
+			topLeftPixels + Vec2<int>{borderThicknessPixels, cellSizePixels * 4 - borderThicknessPixels / 2},
+			topLeftPixels + Vec2<int>{
+				boardWidthCells * cellSizePixels + borderThicknessPixels,
+				cellSizePixels * 4 - borderThicknessPixels / 2
+			},
+			borderThicknessPixels,
+			DARKGRAY
+		);
+		break;
+	case BOARD:
+		if (endlessBoard != nullptr)
+		{
+			endlessBoard->Draw();
+		}
+		else
+		{
+			board.Draw();
+		}
+		break;
+	case DIGITS:
+		timer.Draw();
+		flagCounter.Draw();
+		break;
+	case FACE:
+		faceButton.Draw();
+		break;
+	case MINIMAP:
+		if (endlessBoard == nullptr)
+		{
+			minimap.Draw();
+		}
+		break;
+	case DRAW_LAYER_COUNT:
+		break;
+	}
+}
+
+// Only the screen positions and the cell size change, the board model is left as is
+void GameSession::SetLayout(const Vec2<int>& newTopLeftPixels, const int& cellSize)
+{
+	topLeftPixels = newTopLeftPixels;
+	cellSizePixels = cellSize;
+	borderThicknessPixels = cellSize / 2;
+
+	board.SetLayout(GetBoardScreenPosition(), cellSizePixels);
+	if (endlessBoard != nullptr)
+	{
+		endlessBoard->SetLayout(GetBoardScreenPosition(), cellSizePixels);
+	}
+	flagCounter.SetLayout(topLeftPixels + GetFlagCounterScreenPosition(cellSizePixels), cellSizePixels);
+	faceButton.SetLayout(topLeftPixels + GetFaceButtonScreenPosition(cellSizePixels, borderThicknessPixels, boardWidthCells), cellSizePixels);
+	timer.SetLayout(topLeftPixels + GetTimerScreenPosition(cellSizePixels, boardWidthCells), cellSizePixels);
+	minimap.SetLayout(topLeftPixels + GetMinimapScreenPosition(cellSizePixels), cellSizePixels);
+}
+
+bool GameSession::IsGameInProgress() const
+{
+	return endlessBoard != nullptr ? endlessBoard->IsGameInProgress() : board.IsGameInProgress();
+}
+
+bool GameSession::ContainsPoint(const Vec2<int>& pointPixels) const
+{
+	const Vec2<int> sizePixels = GetWindowSize(cellSizePixels, borderThicknessPixels, boardWidthCells, boardHeightCells);
+
+	return pointPixels.x >= topLeftPixels.x && pointPixels.x < topLeftPixels.x + sizePixels.x
+		&& pointPixels.y >= topLeftPixels.y && pointPixels.y < topLeftPixels.y + sizePixels.y;
+}
+
+Vec2<int> GameSession::GetBoardScreenPosition() const
+{
+	return topLeftPixels + Settings::GetBoardScreenPosition(cellSizePixels, borderThicknessPixels);
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+void GameSession::UpdateShortcuts()
+{
+	const InputQueue& input = InputQueue::GetInstance();
+	const bool isControlDown = IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL);
+
+	if (input.IsKeyPressed(SAVE_GAME_KEY))
+	{
+		board.SaveSnapshot(timer.GetTimeElapsed());
+	}
+	else if (input.IsKeyPressed(LOAD_GAME_KEY))
+	{
+		board.LoadSnapshot();
+	}
+	else if (isControlDown && input.IsKeyPressed(UNDO_KEY))
+	{
+		board.Undo();
+	}
+	else if (isControlDown && input.IsKeyPressed(REDO_KEY))
+	{
+		board.Redo();
+	}
+	else if (input.IsKeyPressed(HINT_KEY))
+	{
+		board.ShowHint();
+	}
+}
+
+void GameSession::OnGameRestarted()
+{
+	isGameWon = false;
+	isGameLost = false;
+
+	timer.Reset();
+	flagCounter.Reset();
+	faceButton.Reset();
+
+	if (endlessBoard != nullptr)
+	{
+		endlessBoard->Reset();
+		endlessBoard->NotifyFlagToggleObservers();
+	}
+	else
+	{
+		board.Reset();
+		board.NotifyFlagToggleObservers();
+	}
+
+#if defined DEBUG
+	std::cout << "GAME RESTARTED!\n";
+#endif
+}
+
+void GameSession::OnGameWon()
+{
+	isGameWon = true;
+}
+
+void GameSession::OnGameLost()
+{
+	isGameLost = true;
+}
+
+// The loaded game is always in progress, even if the current one has already ended
+void GameSession::OnSnapshotLoaded(const double& timeElapsed)
+{
+	isGameWon = false;
+	isGameLost = false;
+	faceButton.Reset();
+	timer.SetTimeElapsed(timeElapsed);
+}
@@ -0,0 +1,119 @@
+#include "input_queue.h"
+#include "settings.h"
+
+#include <raylib.h>
+
+#include <algorithm>
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+InputQueue& InputQueue::GetInstance()
+{
+	static InputQueue instance;
+
+	return instance;
+}
+
+void InputQueue::Sample()
+{
+	const double time = GetTime();
+	auto [mouseX, mouseY] = GetMousePosition();
+	currentState.position = Vec2<int>(static_cast<int>(mouseX), static_cast<int>(mouseY));
+	currentState.time = time;
+
+	// Buttons that changed during the same poll are taken in a fixed order, the OS order is lost at this point
+	for (int button = 0; button < static_cast<int>(currentState.buttonsDown.size()); ++button)
+	{
+		const bool isDown = IsMouseButtonDown(button);
+		if (isDown == currentState.buttonsDown[button])
+		{
+			continue;
+		}
+
+		currentState.buttonsDown[button] = isDown;
+
+		MouseState event = currentState;
+		event.buttonsReleased[button] = !isDown;
+		PushMouseState(event);
+	}
+
+	for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed())
+	{
+		if (keysPressedAmount < keysPressed.size())
+		{
+			keysPressed[keysPressedAmount++] = key;
+		}
+	}
+
+	isWindowResized = isWindowResized || ::IsWindowResized();
+}
+
+// Raylib's own frame limiter would sleep through the rest of the frame in EndDrawing without looking at the input,
+// so the frames are paced here instead
+void InputQueue::WaitForNextFrame(const double nextFrameTime)
+{
+	constexpr double SAMPLE_INTERVAL_SECONDS = 1.0 / Settings::INPUT_SAMPLE_RATE;
+
+	Sample(); // EndDrawing has just polled the events
+
+	for (double time = GetTime(); time < nextFrameTime; time = GetTime())
+	{
+		WaitTime(std::min(SAMPLE_INTERVAL_SECONDS, nextFrameTime - time));
+		PollInputEvents();
+		Sample();
+	}
+}
+
+void InputQueue::BeginFrame()
+{
+	PushMouseState(currentState); // Never has any buttons released, so it only moves the mouse and holds buttons down
+}
+
+void InputQueue::EndFrame()
+{
+	mouseStates.clear();
+	keysPressedAmount = 0;
+	isWindowResized = false;
+}
+
+bool InputQueue::IsKeyPressed(const int key) const
+{
+	return std::find(keysPressed.begin(), keysPressed.begin() + static_cast<std::ptrdiff_t>(keysPressedAmount), key)
+		!= keysPressed.begin() + static_cast<std::ptrdiff_t>(keysPressedAmount);
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+InputQueue::InputQueue()
+{
+	mouseStates.reserve(MOUSE_STATES_CAPACITY);
+}
+
+// The queue never grows past MOUSE_STATES_CAPACITY. A state that doesn't release a button only tells where the mouse
+// was and which buttons were held, which every state after it tells as well, so a full queue drops those to make room.
+// Releases are only dropped if the queue is full of them, which takes well over a hundred clicks within one frame
+void InputQueue::PushMouseState(const MouseState& mouseState)
+{
+	if (mouseStates.size() == MOUSE_STATES_CAPACITY)
+	{
+		std::erase_if(mouseStates, [](const MouseState& queuedState)
+		{
+			return std::ranges::none_of(queuedState.buttonsReleased, [](const bool isReleased) { return isReleased; });
+		});
+	}
+
+	if (mouseStates.size() == MOUSE_STATES_CAPACITY)
+	{
+		return;
+	}
+
+	mouseStates.push_back(mouseState);
+}
@@ -0,0 +1,174 @@
+#include "latency_profiler.h"
+#include "input_queue.h"
+#include "raylib_cpp.h"
+#include "settings.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <utility>
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+LatencyProfiler::LatencyProfiler(const Vec2<int>& screenPos, const int& cellSize, std::string configurationName)
+	: AGameObject(screenPos, cellSize),
+	  configurationName(std::move(configurationName))
+{
+}
+
+void LatencyProfiler::Update()
+{
+	if (InputQueue::GetInstance().IsKeyPressed(Settings::PROFILER_OVERLAY_KEY))
+	{
+		isOverlayVisible = !isOverlayVisible;
+	}
+}
+
+// The overlay has a fixed size in cells, so it scales with the window like everything else
+void LatencyProfiler::Draw() const
+{
+	if (!isOverlayVisible)
+	{
+		return;
+	}
+
+	constexpr int PANEL_WIDTH_CELLS = 8;
+	constexpr int PANEL_HEIGHT_CELLS = 4;
+	constexpr size_t SHOWN_BUCKETS_AMOUNT = BUCKETS_AMOUNT / 2; // Anything slower than 50 ms isn't worth a bar
+
+	const int fontSize = std::max(cellSizePixels / 3, 10);
+	const int padding = std::max(cellSizePixels / 8, 2);
+	const Vec2<int> panelSize{PANEL_WIDTH_CELLS * cellSizePixels, PANEL_HEIGHT_CELLS * cellSizePixels};
+
+	RaylibCpp::DrawRectangle(screenPositionPixels, panelSize, Settings::PROFILER_BACKGROUND_COLOR);
+
+	Vec2<int> textPosition = screenPositionPixels + padding;
+	RaylibCpp::DrawText(TextFormat("Click to present (%s)", configurationName.c_str()), textPosition, fontSize, WHITE);
+
+	textPosition.y += fontSize + padding;
+	RaylibCpp::DrawText(
+		TextFormat("%llu samples, mean %.1f ms",
+		           static_cast<unsigned long long>(samplesAmount),
+		           samplesAmount > 0 ? totalMilliseconds / static_cast<double>(samplesAmount) : 0.0),
+		textPosition,
+		fontSize,
+		WHITE
+	);
+
+	textPosition.y += fontSize + padding;
+	RaylibCpp::DrawText(
+		TextFormat("p50 %.1f  p99 %.1f  max %.1f ms",
+		           GetPercentileMilliseconds(0.5),
+		           GetPercentileMilliseconds(0.99),
+		           maxMilliseconds),
+		textPosition,
+		fontSize,
+		WHITE
+	);
+
+	// One bar per bucket, scaled so that the fullest shown bucket reaches the top
+	const int graphTop = textPosition.y + fontSize + padding;
+	const int graphBottom = screenPositionPixels.y + panelSize.y - padding;
+	const int graphWidth = panelSize.x - padding * 2;
+	const uint64_t fullestBucket = *std::max_element(buckets.begin(), buckets.begin() + SHOWN_BUCKETS_AMOUNT);
+	if (fullestBucket == 0 || graphBottom <= graphTop)
+	{
+		return;
+	}
+
+	for (size_t bucket = 0; bucket < SHOWN_BUCKETS_AMOUNT; ++bucket)
+	{
+		const int barLeft = screenPositionPixels.x + padding + static_cast<int>(bucket * static_cast<size_t>(graphWidth) / SHOWN_BUCKETS_AMOUNT);
+		const int barRight = screenPositionPixels.x + padding + static_cast<int>((bucket + 1) * static_cast<size_t>(graphWidth) / SHOWN_BUCKETS_AMOUNT);
+		const auto barHeight = static_cast<int>(buckets[bucket] * static_cast<uint64_t>(graphBottom - graphTop) / fullestBucket);
+		if (barHeight == 0 || barRight == barLeft)
+		{
+			continue;
+		}
+
+		RaylibCpp::DrawRectangle(Vec2<int>{barLeft, graphBottom - barHeight},
+		                         Vec2<int>{barRight - barLeft, barHeight},
+		                         Settings::PROFILER_BAR_COLOR);
+	}
+}
+
+void LatencyProfiler::Reset()
+{
+	buckets = {};
+	samplesAmount = 0;
+	totalMilliseconds = 0;
+	maxMilliseconds = 0;
+}
+
+void LatencyProfiler::RecordLatency(const double latencySeconds)
+{
+	const double milliseconds = std::max(latencySeconds * 1000.0, 0.0);
+	const auto bucket = std::min(static_cast<size_t>(milliseconds / BUCKET_MILLISECONDS), BUCKETS_AMOUNT - 1);
+
+	buckets[bucket]++;
+	samplesAmount++;
+	totalMilliseconds += milliseconds;
+	maxMilliseconds = std::max(maxMilliseconds, milliseconds);
+}
+
+// The file is plain CSV, one row per bucket, with the settings and the summary in comment lines above it
+bool LatencyProfiler::WriteHistogram(const std::string& filePath) const
+{
+	std::ofstream file{filePath};
+	if (!file)
+	{
+		return false;
+	}
+
+	file << "# Click to present latency, " << configurationName << "\n";
+	file << "# samples = " << samplesAmount
+		<< ", mean = " << (samplesAmount > 0 ? totalMilliseconds / static_cast<double>(samplesAmount) : 0.0)
+		<< " ms, p50 = " << GetPercentileMilliseconds(0.5)
+		<< " ms, p90 = " << GetPercentileMilliseconds(0.9)
+		<< " ms, p99 = " << GetPercentileMilliseconds(0.99)
+		<< " ms, max = " << maxMilliseconds << " ms\n";
+	file << "bucket_start_ms,bucket_end_ms,count\n";
+
+	for (size_t bucket = 0; bucket < BUCKETS_AMOUNT; ++bucket)
+	{
+		file << static_cast<double>(bucket) * BUCKET_MILLISECONDS << ",";
+		if (bucket + 1 < BUCKETS_AMOUNT)
+		{
+			file << static_cast<double>(bucket + 1) * BUCKET_MILLISECONDS;
+		}
+		file << "," << buckets[bucket] << "\n";
+	}
+
+	return file.good();
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+double LatencyProfiler::GetPercentileMilliseconds(const double percentile) const
+{
+	if (samplesAmount == 0)
+	{
+		return 0;
+	}
+
+	const auto rank = static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(samplesAmount)));
+	uint64_t samplesBelow = 0;
+	for (size_t bucket = 0; bucket < BUCKETS_AMOUNT; ++bucket)
+	{
+		samplesBelow += buckets[bucket];
+		if (samplesBelow >= rank)
+		{
+			return std::min(static_cast<double>(bucket + 1) * BUCKET_MILLISECONDS, maxMilliseconds);
+		}
+	}
+
+	return maxMilliseconds;
+}
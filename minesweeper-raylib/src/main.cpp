@@ -1,21 +1,46 @@
+#include "board.h"
 #include "game.h"
+#include "raylib_cpp.h"
 #include "settings.h"
+#include "shared_board.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
 
 void CreateGameConfigFile(const std::string& filePath)
 {
 	std::ofstream file{filePath};
 
-	file << "# The difficulty can be set to either 'beginner', 'intermediate', 'expert', or 'custom'. Invalid values get reset to 'intermediate'.\n";
+	file << "# The difficulty can be set to either 'beginner', 'intermediate', 'expert', 'custom', or 'endless'. Invalid values get reset to 'intermediate'.\n";
 	file << "difficulty = intermediate\n\n";
 	file << "# The minimum cell size is 16 pixels. Invalid values get set to the minimum.\n";
 	file << "cell_size_pixels = 64\n\n";
+	file << "# When set to 'true', every cell that gets opened is chorded automatically if it can be, until there's nothing left to chord. Placing a flag never chords anything.\n";
+	file << "auto_chord = false\n\n";
+	file << "# The chance of any cell having a mine when the difficulty is set to 'endless'. Values get clamped between 0.12 and 0.5.\n";
+	file << "endless_mine_density = 0.16\n\n";
+	file << "# How many frames are drawn per second. Values under 1 get reset to 60.\n";
+	file << "fps = 60\n\n";
+	file << "# When set to 'true', the frames are synced to the monitor's refresh rate.\n";
+	file << "vsync = false\n\n";
+	file << "# When set to 'true', the time from a click to the frame that shows its result is measured. F3 shows the measurements, and they're written to latency_histogram.csv when the game is closed.\n";
+	file << "latency_profiling = false\n\n";
+	file << "# When set to 'true', the board runs on a thread of its own, so large reveals and hints never hold up drawing or input.\n";
+	file << "# It's off by default since the board's changes then show up a frame later, it only pays off on huge boards.\n";
+	file << "threaded_simulation = false\n\n";
+	file << "# When set to a name like '/minesweeper', the board's open, flag and number planes are put into a POSIX shared memory segment with that name, and bots can play moves through a ring in the same segment, see shared_board.h. 'none' turns it off.\n";
+	file << "shared_board_name = none\n\n";
+	file << "# How many games are played side by side in the window, each with a board of its own, up to 64. The keyboard shortcuts go to the game under the mouse. When there's more than one game, the shared board name gets the game's number (starting from 0) added to it. Endless games are always played alone.\n";
+	file << "split_screen_sessions = 1\n\n";
 	file << "##########################################################################\n";
 	file << "# The settings below are only used if the difficulty is set to 'custom'. #\n";
 	file << "##########################################################################\n\n";
-	file << "# The minimum width is 8 and minimum height is 1. Values less than that get set to the minimum.\n";
+	file << "# The minimum width is 8 and minimum height is 1, the maximum of both is 4294967295. Values outside of that get set to the nearest limit. A cell takes three quarters of a byte (and 3 more bytes when the board is shared), and all of the window's boards together can take at most 8 GiB. The game doesn't start if they'd take more, and says why. Only as many cells as fit into the window are shown.\n";
 	file << "board_width = 16\n";
 	file << "board_height = 16\n\n";
 	file << "# The minimum amount of mines is 0 and the maximum amount is the number of cells on the board. Values under 0 get set to 0 and values over the maximum fill the entire board with mines.\n";
@@ -24,9 +49,17 @@ void CreateGameConfigFile(const std::string& filePath)
 
 void LoadGameConfigFromFile(Settings::Difficulty& difficulty,
                             int& cellSize,
-                            int& boardWidthCells,
-                            int& boardHeightCells,
-                            int& maxMines)
+                            int64_t& boardWidthCells,
+                            int64_t& boardHeightCells,
+                            int64_t& maxMines,
+                            bool& autoChord,
+                            double& endlessMineDensity,
+                            int& fps,
+                            bool& vsync,
+                            bool& latencyProfiling,
+                            bool& threadedSimulation,
+                            std::string& sharedBoardName,
+                            int& sessionsAmount)
 {
 	const std::string filePath = "config.ini";
 
@@ -46,12 +79,6 @@ void LoadGameConfigFromFile(Settings::Difficulty& difficulty,
 
 	while (file.good())
 	{
-		// We don't need to parse more of the config file if we've already got a standard difficulty and cell size
-		if (difficulty != Settings::INVALID && difficulty != Settings::CUSTOM && cellSize != -1)
-		{
-			return;
-		}
-
 		file >> inputToken;
 		std::ranges::transform(inputToken, inputToken.begin(), tolower);
 
@@ -66,6 +93,7 @@ void LoadGameConfigFromFile(Settings::Difficulty& difficulty,
 			else if (inputDifficulty == "intermediate")	{ difficulty = Settings::INTERMEDIATE; }
 			else if (inputDifficulty == "expert")		{ difficulty = Settings::EXPERT; }
 			else if (inputDifficulty == "custom")		{ difficulty = Settings::CUSTOM; }
+			else if (inputDifficulty == "endless")		{ difficulty = Settings::ENDLESS; }
 		}
 		else if (inputToken == "cell_size_pixels")
 		{
@@ -83,28 +111,104 @@ void LoadGameConfigFromFile(Settings::Difficulty& difficulty,
 		{
 			file >> inputToken >> maxMines;
 		}
+		else if (inputToken == "auto_chord")
+		{
+			std::string inputAutoChord;
+			file >> inputToken >> inputAutoChord;
+
+			std::ranges::transform(inputAutoChord, inputAutoChord.begin(), tolower);
+
+			autoChord = inputAutoChord == "true";
+		}
+		else if (inputToken == "endless_mine_density")
+		{
+			file >> inputToken >> endlessMineDensity;
+		}
+		else if (inputToken == "fps")
+		{
+			file >> inputToken >> fps;
+		}
+		else if (inputToken == "vsync")
+		{
+			std::string inputVsync;
+			file >> inputToken >> inputVsync;
+
+			std::ranges::transform(inputVsync, inputVsync.begin(), tolower);
+
+			vsync = inputVsync == "true";
+		}
+		else if (inputToken == "latency_profiling")
+		{
+			std::string inputLatencyProfiling;
+			file >> inputToken >> inputLatencyProfiling;
+
+			std::ranges::transform(inputLatencyProfiling, inputLatencyProfiling.begin(), tolower);
+
+			latencyProfiling = inputLatencyProfiling == "true";
+		}
+		else if (inputToken == "threaded_simulation")
+		{
+			std::string inputThreadedSimulation;
+			file >> inputToken >> inputThreadedSimulation;
+
+			std::ranges::transform(inputThreadedSimulation, inputThreadedSimulation.begin(), tolower);
+
+			threadedSimulation = inputThreadedSimulation == "true";
+		}
+		else if (inputToken == "shared_board_name")
+		{
+			std::string inputSharedBoardName;
+			file >> inputToken >> inputSharedBoardName;
+
+			// The name is case sensitive, so only 'none' is compared without it
+			std::string lowercaseSharedBoardName = inputSharedBoardName;
+			std::ranges::transform(lowercaseSharedBoardName, lowercaseSharedBoardName.begin(), tolower);
+
+			sharedBoardName = lowercaseSharedBoardName == "none" ? "" : inputSharedBoardName;
+		}
+		else if (inputToken == "split_screen_sessions")
+		{
+			file >> inputToken >> sessionsAmount;
+		}
 
 		// This makes sure we parse the file one line at a time and ignore any tokens after a setting's value
 		file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 	}
 }
 
-void ValidateGameConfig(Settings::Difficulty& difficulty,
-                        int& cellSize,
-                        int& boardWidthCells,
-                        int& boardHeightCells,
-                        int& maxMines)
+// Settings that are out of range are set to the nearest value that works. Returns false if the boards don't fit into
+// memory, which has no such value, with the reason in errorMessage
+[[nodiscard]] bool ValidateGameConfig(Settings::Difficulty& difficulty,
+                                      int& cellSize,
+                                      int64_t& boardWidthCells,
+                                      int64_t& boardHeightCells,
+                                      int64_t& maxMines,
+                                      double& endlessMineDensity,
+                                      int& fps,
+                                      int& sessionsAmount,
+                                      const std::string& sharedBoardName,
+                                      std::string& errorMessage)
 {
 	if (cellSize < 16)
 	{
 		cellSize = 16;
 	}
 
+	if (fps < 1)
+	{
+		fps = Settings::FPS;
+	}
+
+	endlessMineDensity = std::clamp(endlessMineDensity, Settings::ENDLESS_MIN_MINE_DENSITY, Settings::ENDLESS_MAX_MINE_DENSITY);
+
 	if (difficulty == Settings::INVALID)
 	{
 		difficulty = Settings::INTERMEDIATE;
 	}
 
+	// Every endless board would follow the same camera keys
+	sessionsAmount = difficulty == Settings::ENDLESS ? 1 : std::clamp(sessionsAmount, 1, Settings::MAX_SPLIT_SCREEN_SESSIONS);
+
 	if (difficulty != Settings::CUSTOM)
 	{
 		boardWidthCells = GetDifficultyBoardWidth(difficulty);
@@ -113,46 +217,117 @@ void ValidateGameConfig(Settings::Difficulty& difficulty,
 	}
 	else
 	{
-		if (boardWidthCells < 8)
-		{
-			boardWidthCells = 8;
-		}
+		boardWidthCells = std::clamp<int64_t>(boardWidthCells, 8, Settings::MAX_BOARD_DIMENSION_CELLS);
+		boardHeightCells = std::clamp<int64_t>(boardHeightCells, 1, Settings::MAX_BOARD_DIMENSION_CELLS);
 
-		if (boardHeightCells < 1)
+		// Both sides fit into 32 bits, so the amount of cells fits into 64
+		const auto width = static_cast<size_t>(boardWidthCells);
+		const auto height = static_cast<size_t>(boardHeightCells);
+		const uint64_t cellsAmount = static_cast<uint64_t>(width) * height;
+
+		// Every session allocates a board of its own, so they share the budget. A board that doesn't fit isn't made
+		// smaller than what was asked for, the game tells why it can't start instead. A cell takes at least half a
+		// byte, so boards with more cells than this never fit, and adding up what they'd take could overflow
+		const bool isTooLarge = cellsAmount / 2 > Settings::MAX_BOARDS_MEMORY_BYTES;
+		const uint64_t boardMemory = isTooLarge
+			                             ? cellsAmount / 2
+			                             : Board::GetMemoryFootprint(width, height)
+			                             + (sharedBoardName.empty() ? 0 : SharedBoard::GetSegmentSize(width, height));
+
+		if (isTooLarge || boardMemory > Settings::MAX_BOARDS_MEMORY_BYTES / static_cast<uint64_t>(sessionsAmount))
 		{
-			boardHeightCells = 1;
+			constexpr double BYTES_PER_GIB = 1 << 30;
+			std::ostringstream message;
+			message << std::fixed << std::setprecision(1)
+				<< sessionsAmount << (sessionsAmount == 1 ? " board" : " boards") << " of " << width << "x" << height
+				<< " cells would take " << (isTooLarge ? "over " : "")
+				<< static_cast<double>(boardMemory) / BYTES_PER_GIB * sessionsAmount << " GiB of memory,\n"
+				<< "but the game can only take " << static_cast<double>(Settings::MAX_BOARDS_MEMORY_BYTES) / BYTES_PER_GIB << " GiB.\n"
+				<< "Lower board_width, board_height or split_screen_sessions in config.ini"
+				<< (sharedBoardName.empty() ? "." : ", or set shared_board_name to none.");
+			errorMessage = message.str();
+
+			return false;
 		}
 
 		if (maxMines < 0)
 		{
 			maxMines = 0;
 		}
-		else if (maxMines > boardWidthCells * boardHeightCells)
+		else if (static_cast<uint64_t>(maxMines) > cellsAmount)
 		{
-			maxMines = boardWidthCells * boardHeightCells;
+			maxMines = static_cast<int64_t>(cellsAmount);
 		}
 	}
+
+	return true;
+}
+
+// The game is usually started without a console to print to, so the error gets a window of its own as well
+void ShowConfigError(const std::string& errorMessage)
+{
+	std::cerr << errorMessage << "\n";
+
+	constexpr int FONT_SIZE = 20;
+	constexpr int MARGIN_PIXELS = 20;
+	const std::string text = errorMessage + "\n\nPress Escape to close.";
+
+	InitWindow(640, 160, "Minesweeper");
+	const Vector2 textSize = MeasureTextEx(GetFontDefault(), text.c_str(), FONT_SIZE, FONT_SIZE / 10.0f);
+	SetWindowSize(static_cast<int>(textSize.x) + MARGIN_PIXELS * 2, static_cast<int>(textSize.y) + MARGIN_PIXELS * 2);
+	SetTargetFPS(Settings::FPS);
+
+	while (!WindowShouldClose())
+	{
+		BeginDrawing();
+		ClearBackground(RAYWHITE);
+		RaylibCpp::DrawText(text.c_str(), Vec2<int>{MARGIN_PIXELS}, FONT_SIZE, BLACK);
+		EndDrawing();
+	}
+
+	CloseWindow();
 }
 
 int main()
 {
 	Settings::Difficulty difficulty = Settings::INVALID;
 	int cellSize = -1;
-	int boardWidthCells = -1;
-	int boardHeightCells = -1;
-	int maxMines = -1;
+	int64_t boardWidthCells = -1;
+	int64_t boardHeightCells = -1;
+	int64_t maxMines = -1;
+	bool autoChord = false;
+	double endlessMineDensity = Settings::ENDLESS_DEFAULT_MINE_DENSITY;
+	int fps = Settings::FPS;
+	bool vsync = false;
+	bool latencyProfiling = false;
+	bool threadedSimulation = false;
+	std::string sharedBoardName;
+	int sessionsAmount = 1;
 
-	LoadGameConfigFromFile(difficulty, cellSize, boardWidthCells, boardHeightCells, maxMines);
+	LoadGameConfigFromFile(difficulty, cellSize, boardWidthCells, boardHeightCells, maxMines, autoChord, endlessMineDensity, fps, vsync, latencyProfiling, threadedSimulation, sharedBoardName, sessionsAmount);
 
-	ValidateGameConfig(difficulty, cellSize, boardWidthCells, boardHeightCells, maxMines);
+	if (std::string errorMessage;
+		!ValidateGameConfig(difficulty, cellSize, boardWidthCells, boardHeightCells, maxMines, endlessMineDensity, fps, sessionsAmount, sharedBoardName, errorMessage))
+	{
+		ShowConfigError(errorMessage);
+		return 1;
+	}
 
 	Game game{
-		Settings::FPS,
+		fps,
 		"Minesweeper",
 		cellSize,
-		boardWidthCells,
-		boardHeightCells,
-		maxMines,
+		static_cast<size_t>(boardWidthCells),
+		static_cast<size_t>(boardHeightCells),
+		static_cast<uint64_t>(maxMines),
+		autoChord,
+		difficulty == Settings::ENDLESS,
+		endlessMineDensity,
+		vsync,
+		latencyProfiling,
+		threadedSimulation,
+		sharedBoardName,
+		sessionsAmount,
 	};
 
 	while (!game.GameShouldClose())
@@ -0,0 +1,273 @@
+#include "minimap.h"
+#include "raylib_cpp.h"
+#include "settings.h"
+
+#include <algorithm>
+#include <cassert>
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+Minimap::Minimap(const Vec2<int>& screenPos,
+                 const int& cellSize,
+                 const size_t boardWidthCells,
+                 const size_t boardHeightCells,
+                 const Vec2<int> viewSizeCells)
+	: AGameObject(screenPos, cellSize),
+	  boardWidthCells(boardWidthCells),
+	  boardHeightCells(boardHeightCells),
+	  viewSizeCells(viewSizeCells),
+	  blockSizeCells((std::max(boardWidthCells, boardHeightCells) + Settings::MINIMAP_MAX_TEXTURE_SIZE - 1) / Settings::MINIMAP_MAX_TEXTURE_SIZE),
+	  textureSize{
+		  static_cast<int>((boardWidthCells + blockSizeCells - 1) / blockSizeCells),
+		  static_cast<int>((boardHeightCells + blockSizeCells - 1) / blockSizeCells)
+	  }
+{
+	assert(boardWidthCells > 0 && boardHeightCells > 0 && "The minimap needs a board with at least one cell");
+
+	const size_t blocksAmount = static_cast<size_t>(textureSize.x) * static_cast<size_t>(textureSize.y);
+	openCells.resize(blocksAmount);
+	flaggedCells.resize(blocksAmount);
+	pixels.assign(blocksAmount, Settings::MINIMAP_CLOSED_COLOR);
+	uploadBuffer.reserve(blocksAmount);
+	changedBlocks = IndexSet(std::min(blocksAmount, static_cast<size_t>(4096)));
+}
+
+// Like the atlases in ResourcesSingleton, the texture is only released once the program is done with it
+Minimap::~Minimap()
+{
+	if (texture.id != 0)
+	{
+		UnloadTexture(texture);
+	}
+}
+
+void Minimap::Update()
+{
+	if (texture.id == 0)
+	{
+		assert(GetWindowHandle() && "Cannot load the minimap texture, since window doesn't exist");
+
+		const Image image = GenImageColor(textureSize.x, textureSize.y, Settings::MINIMAP_CLOSED_COLOR);
+		texture = LoadTextureFromImage(image);
+		UnloadImage(image);
+	}
+
+	UploadChangedPixels();
+}
+
+void Minimap::Draw() const
+{
+	// The minimap only gets the room that's left over in the header, which small boards don't have.
+	// Both positions are relative to the game the minimap is in, which doesn't have to start at the window's corner
+	const int availableWidth = Settings::GetFaceButtonScreenPosition(cellSizePixels, cellSizePixels / 2, viewSizeCells.x).x
+		- cellSizePixels / 2
+		- Settings::GetMinimapScreenPosition(cellSizePixels).x;
+	const int availableHeight = cellSizePixels * 2;
+	if (texture.id == 0 || availableWidth < cellSizePixels)
+	{
+		return;
+	}
+
+	const float scale = std::min(static_cast<float>(availableWidth) / static_cast<float>(textureSize.x),
+	                             static_cast<float>(availableHeight) / static_cast<float>(textureSize.y));
+	const Vec2<int> sizePixels{
+		std::max(static_cast<int>(static_cast<float>(textureSize.x) * scale), 1),
+		std::max(static_cast<int>(static_cast<float>(textureSize.y) * scale), 1)
+	};
+	const Vec2<int> topLeft = screenPositionPixels
+		+ Vec2<int>{(availableWidth - sizePixels.x) / 2, (availableHeight - sizePixels.y) / 2};
+
+	RaylibCpp::DrawTexturePro(
+		texture,
+		Rectangle{0, 0, static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)},
+		topLeft,
+		sizePixels,
+		Vec2<int>{0},
+		0,
+		WHITE
+	);
+
+	// Outline the part of the board that fits into the window, unless that's the whole board
+	if (static_cast<size_t>(viewSizeCells.x) < boardWidthCells || static_cast<size_t>(viewSizeCells.y) < boardHeightCells)
+	{
+		const float cellScale = scale / static_cast<float>(blockSizeCells);
+		const Vec2<int> viewSizePixels{
+			std::max(static_cast<int>(static_cast<float>(viewSizeCells.x) * cellScale), 2),
+			std::max(static_cast<int>(static_cast<float>(viewSizeCells.y) * cellScale), 2)
+		};
+
+		RaylibCpp::DrawRectangleLinesEx(topLeft, viewSizePixels, 1, Settings::MINIMAP_VIEW_OUTLINE_COLOR);
+	}
+}
+
+void Minimap::Reset()
+{
+	std::ranges::fill(openCells, 0);
+	std::ranges::fill(flaggedCells, 0);
+	std::ranges::fill(pixels, Settings::MINIMAP_CLOSED_COLOR);
+	changedBlocks.Clear();
+	isWholeTextureChanged = true;
+}
+
+
+//	#####################
+//	# Private functions #
+//	#####################
+
+
+// A run is split at the edges of the blocks and rows it crosses, so a long run only touches each of its blocks once
+void Minimap::OnCellsChanged(const std::span<const CellChange> changes)
+{
+	for (const auto& [firstCellIndex, cellsAmount, type] : changes)
+	{
+		const size_t changesEnd = firstCellIndex + cellsAmount;
+		for (size_t cellIndex = firstCellIndex; cellIndex < changesEnd;)
+		{
+			const size_t x = cellIndex % boardWidthCells;
+			const size_t blockEndX = std::min((x / blockSizeCells + 1) * blockSizeCells, boardWidthCells);
+			const size_t segmentEnd = std::min(changesEnd, cellIndex - x + blockEndX);
+			const auto segmentCellsAmount = static_cast<uint32_t>(segmentEnd - cellIndex);
+			const size_t blockIndex = GetBlockIndex(cellIndex);
+
+			switch (type)
+			{
+			case CellChange::OPENED:
+				openCells[blockIndex] += segmentCellsAmount;
+				break;
+			case CellChange::CLOSED:
+				openCells[blockIndex] -= segmentCellsAmount;
+				break;
+			case CellChange::FLAGGED:
+				flaggedCells[blockIndex] += segmentCellsAmount;
+				break;
+			case CellChange::UNFLAGGED:
+				flaggedCells[blockIndex] -= segmentCellsAmount;
+				break;
+			}
+
+			// Once too many blocks have changed to keep track of, the whole texture is uploaded instead
+			pixels[blockIndex] = GetBlockColor(blockIndex);
+			if (!isWholeTextureChanged && !changedBlocks.Insert(blockIndex))
+			{
+				isWholeTextureChanged = true;
+			}
+			cellIndex = segmentEnd;
+		}
+	}
+}
+
+// Clearing is the only time the whole texture is uploaded, which doesn't need to look at the board
+void Minimap::OnBoardCleared()
+{
+	Reset();
+}
+
+size_t Minimap::GetBlockIndex(const size_t& cellIndex) const
+{
+	const size_t blockX = cellIndex % boardWidthCells / blockSizeCells;
+	const size_t blockY = cellIndex / boardWidthCells / blockSizeCells;
+
+	return blockY * static_cast<size_t>(textureSize.x) + blockX;
+}
+
+// Blocks along the right and bottom edges can be cut off by the edge of the board
+uint64_t Minimap::GetBlockCellsAmount(const size_t& blockIndex) const
+{
+	const size_t firstX = blockIndex % static_cast<size_t>(textureSize.x) * blockSizeCells;
+	const size_t firstY = blockIndex / static_cast<size_t>(textureSize.x) * blockSizeCells;
+
+	return static_cast<uint64_t>(std::min(blockSizeCells, boardWidthCells - firstX))
+		* std::min(blockSizeCells, boardHeightCells - firstY);
+}
+
+// Flags stand out, since they'd be lost among the open cells otherwise.
+// The rest of the block is shaded by how much of it is open
+Color Minimap::GetBlockColor(const size_t& blockIndex) const
+{
+	if (flaggedCells[blockIndex] > 0)
+	{
+		return Settings::MINIMAP_FLAGGED_COLOR;
+	}
+
+	const float openFraction = static_cast<float>(openCells[blockIndex]) / static_cast<float>(GetBlockCellsAmount(blockIndex));
+	const auto blend = [openFraction](const unsigned char closed, const unsigned char open)
+	{
+		return static_cast<unsigned char>(static_cast<float>(closed) + static_cast<float>(open - closed) * openFraction);
+	};
+
+	using Settings::MINIMAP_CLOSED_COLOR, Settings::MINIMAP_OPEN_COLOR;
+	return Color{
+		blend(MINIMAP_CLOSED_COLOR.r, MINIMAP_OPEN_COLOR.r),
+		blend(MINIMAP_CLOSED_COLOR.g, MINIMAP_OPEN_COLOR.g),
+		blend(MINIMAP_CLOSED_COLOR.b, MINIMAP_OPEN_COLOR.b),
+		255
+	};
+}
+
+// Changes that are scattered around are uploaded pixel by pixel. Changes that are close together, like a large
+// reveal, are uploaded as the rectangle around them in a single call, which is never more than a few times as
+// many pixels as there are changes
+void Minimap::UploadChangedPixels()
+{
+	if (isWholeTextureChanged)
+	{
+		UpdateTexture(texture, pixels.data());
+		isWholeTextureChanged = false;
+		changedBlocks.Clear();
+		return;
+	}
+
+	if (changedBlocks.IsEmpty())
+	{
+		return;
+	}
+
+	const auto textureWidth = static_cast<size_t>(textureSize.x);
+	size_t minX = SIZE_MAX;
+	size_t minY = SIZE_MAX;
+	size_t maxX = 0;
+	size_t maxY = 0;
+	for (const size_t blockIndex : changedBlocks)
+	{
+		minX = std::min(minX, blockIndex % textureWidth);
+		maxX = std::max(maxX, blockIndex % textureWidth);
+		minY = std::min(minY, blockIndex / textureWidth);
+		maxY = std::max(maxY, blockIndex / textureWidth);
+	}
+
+	const size_t boxWidth = maxX - minX + 1;
+	const size_t boxHeight = maxY - minY + 1;
+
+	if (boxWidth * boxHeight <= changedBlocks.GetSize() * 4)
+	{
+		uploadBuffer.clear();
+		for (size_t y = minY; y <= maxY; ++y)
+		{
+			const auto rowStart = pixels.begin() + static_cast<std::ptrdiff_t>(y * textureWidth + minX);
+			uploadBuffer.insert(uploadBuffer.end(), rowStart, rowStart + static_cast<std::ptrdiff_t>(boxWidth));
+		}
+
+		UpdateTextureRec(
+			texture,
+			Rectangle{static_cast<float>(minX), static_cast<float>(minY), static_cast<float>(boxWidth), static_cast<float>(boxHeight)},
+			uploadBuffer.data()
+		);
+	}
+	else
+	{
+		for (const size_t blockIndex : changedBlocks)
+		{
+			UpdateTextureRec(
+				texture,
+				Rectangle{static_cast<float>(blockIndex % textureWidth), static_cast<float>(blockIndex / textureWidth), 1, 1},
+				&pixels[blockIndex]
+			);
+		}
+	}
+
+	changedBlocks.Clear();
+}
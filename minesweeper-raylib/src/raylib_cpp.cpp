@@ -18,6 +18,15 @@ void RaylibCpp::DrawLineEx(const Vec2<int>& startPos, const Vec2<int>& endPos, c
 	           color);
 }
 
+void RaylibCpp::DrawRectangle(const Vec2<int>& pos, const Vec2<int>& widthHeight, const Color& color)
+{
+	assert(pos.x < GetScreenWidth()
+		&& pos.y < GetScreenHeight()
+		&& "Trying to draw outside of the screen");
+
+	DrawRectangle(pos.x, pos.y, widthHeight.x, widthHeight.y, color);
+}
+
 void RaylibCpp::DrawRectangleLinesEx(const Vec2<int> pos,
                                      const Vec2<int> widthHeight,
                                      const int lineThick,
@@ -39,6 +48,15 @@ void RaylibCpp::DrawRectangleLinesEx(const Vec2<int> pos,
 	);
 }
 
+void RaylibCpp::DrawText(const char* text, const Vec2<int>& pos, const int fontSize, const Color& color)
+{
+	assert(pos.x < GetScreenWidth()
+		&& pos.y < GetScreenHeight()
+		&& "Trying to draw text outside of the screen");
+
+	DrawText(text, pos.x, pos.y, fontSize, color);
+}
+
 void RaylibCpp::DrawTexturePro(const Texture& texture,
                                const Rectangle& spriteRect,
                                const Vec2<int>& destTopLeft,
@@ -64,3 +82,19 @@ void RaylibCpp::DrawTexturePro(const Texture& texture,
 	               color
 	);
 }
+
+void RaylibCpp::DrawTextureRec(const Texture& texture,
+                               const Rectangle& spriteRect,
+                               const Vec2<int>& destTopLeft,
+                               const Color& color)
+{
+	assert(destTopLeft.x < GetScreenWidth()
+		&& destTopLeft.y < GetScreenHeight()
+		&& "Trying to draw texture outside of the screen");
+
+	DrawTextureRec(texture,
+	               spriteRect,
+	               Vector2{static_cast<float>(destTopLeft.x), static_cast<float>(destTopLeft.y)},
+	               color
+	);
+}
@@ -1,6 +1,11 @@
 #include "resources_singleton.h"
+#include "embedded_resources.h"
 
 #include <cassert>
+#include <cstring>
+
+// The sprites in the source atlases are laid out in units of this many pixels
+constexpr int ATLAS_UNIT_PIXELS = 32;
 
 ResourcesSingleton& ResourcesSingleton::GetInstance()
 {
@@ -9,41 +14,143 @@ ResourcesSingleton& ResourcesSingleton::GetInstance()
 	return instance;
 }
 
-Texture2D& ResourcesSingleton::GetCellAtlasTexture()
+Rectangle ResourcesSingleton::ScaledAtlases::GetSprite(const Rectangle& atlasSprite) const
 {
-	return cellAtlasTexture;
+	const float scale = static_cast<float>(cellSizePixels) / ATLAS_UNIT_PIXELS;
+
+	return Rectangle{
+		atlasSprite.x * scale,
+		atlasSprite.y * scale,
+		atlasSprite.width * scale,
+		atlasSprite.height * scale
+	};
 }
 
-Texture2D& ResourcesSingleton::GetDigitsAtlasTexture()
+const ResourcesSingleton::ScaledAtlases& ResourcesSingleton::GetScaledAtlases(const int cellSizePixels)
 {
-	return digitsAtlasTexture;
+	if (scaledAtlases.cellSizePixels == cellSizePixels)
+	{
+		return scaledAtlases;
+	}
+
+	assert(GetWindowHandle() && "Cannot load texture data, since window doesn't exist");
+	assert(cellSizePixels > 0 && "Cannot scale the atlases to a cell size smaller than 1");
+
+	UnloadScaledAtlases();
+
+	// The atlases are compiled into the executable as raw pixels, so they're scaled straight from memory
+	scaledAtlases.cellSizePixels = cellSizePixels;
+	scaledAtlases.cellAtlasTexture = LoadScaledAtlasTexture(
+		GetEmbeddedImage(EmbeddedResources::CELL_ATLAS_PIXELS,
+		                 EmbeddedResources::CELL_ATLAS_WIDTH,
+		                 EmbeddedResources::CELL_ATLAS_HEIGHT),
+		Vec2<int>{32},
+		cellSizePixels);
+	scaledAtlases.digitsAtlasTexture = LoadScaledAtlasTexture(
+		GetEmbeddedImage(EmbeddedResources::DIGITS_ATLAS_PIXELS,
+		                 EmbeddedResources::DIGITS_ATLAS_WIDTH,
+		                 EmbeddedResources::DIGITS_ATLAS_HEIGHT),
+		Vec2<int>{32, 64},
+		cellSizePixels);
+	scaledAtlases.faceAtlasTexture = LoadScaledAtlasTexture(
+		GetEmbeddedImage(EmbeddedResources::FACE_ATLAS_PIXELS,
+		                 EmbeddedResources::FACE_ATLAS_WIDTH,
+		                 EmbeddedResources::FACE_ATLAS_HEIGHT),
+		Vec2<int>{64},
+		cellSizePixels);
+
+	return scaledAtlases;
 }
 
-Texture2D& ResourcesSingleton::GetFaceAtlasTexture()
+// The returned image points to static memory, so it must not be passed to UnloadImage()
+Image ResourcesSingleton::GetEmbeddedImage(const unsigned char* pixels, const int width, const int height)
 {
-	return faceAtlasTexture;
+	return Image{
+		const_cast<unsigned char*>(pixels),
+		width,
+		height,
+		1,
+		PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+	};
 }
 
-ResourcesSingleton::ResourcesSingleton()
+Image ResourcesSingleton::GetIconImage()
 {
-	assert(GetWindowHandle() && "Cannot load texture data, since window doesn't exist");
+	return GetEmbeddedImage(EmbeddedResources::ICON_PIXELS, EmbeddedResources::ICON_WIDTH, EmbeddedResources::ICON_HEIGHT);
+}
 
-	const Image cellAtlasImage = LoadImage("resources/cell_atlas.png");
-	cellAtlasTexture = LoadTextureFromImage(cellAtlasImage);
-	UnloadImage(cellAtlasImage);
+ResourcesSingleton::~ResourcesSingleton()
+{
+	UnloadScaledAtlases();
+}
 
-	const Image digitsAtlasImage = LoadImage("resources/digits_atlas.png");
-	digitsAtlasTexture = LoadTextureFromImage(digitsAtlasImage);
-	UnloadImage(digitsAtlasImage);
+void ResourcesSingleton::UnloadScaledAtlases()
+{
+	if (scaledAtlases.cellSizePixels == 0)
+	{
+		return;
+	}
 
-	const Image faceAtlasImage = LoadImage("resources/face_atlas.png");
-	faceAtlasTexture = LoadTextureFromImage(faceAtlasImage);
-	UnloadImage(faceAtlasImage);
+	UnloadTexture(scaledAtlases.cellAtlasTexture);
+	UnloadTexture(scaledAtlases.digitsAtlasTexture);
+	UnloadTexture(scaledAtlases.faceAtlasTexture);
+	scaledAtlases = {};
 }
 
-ResourcesSingleton::~ResourcesSingleton()
+// Every sprite is resized on its own, so the resampling never bleeds pixels over from neighboring sprites
+Texture2D ResourcesSingleton::LoadScaledAtlasTexture(const Image& atlas, const Vec2<int>& spriteSize, const int cellSizePixels)
 {
-	UnloadTexture(cellAtlasTexture);
-	UnloadTexture(digitsAtlasTexture);
-	UnloadTexture(faceAtlasTexture);
+	const Vec2<int> scaledSpriteSize{
+		spriteSize.x * cellSizePixels / ATLAS_UNIT_PIXELS,
+		spriteSize.y * cellSizePixels / ATLAS_UNIT_PIXELS
+	};
+	const Vec2<int> spritesAmount{atlas.width / spriteSize.x, atlas.height / spriteSize.y};
+	const Vec2<int> scaledAtlasSize = spritesAmount * scaledSpriteSize;
+	const bool isIntegerScale = cellSizePixels % ATLAS_UNIT_PIXELS == 0;
+
+	Image scaledAtlas = GenImageColor(scaledAtlasSize.x, scaledAtlasSize.y, BLANK);
+
+	for (int spriteY = 0; spriteY < spritesAmount.y; ++spriteY)
+	{
+		for (int spriteX = 0; spriteX < spritesAmount.x; ++spriteX)
+		{
+			Image sprite = ImageFromImage(atlas, Rectangle{
+				                              static_cast<float>(spriteX * spriteSize.x),
+				                              static_cast<float>(spriteY * spriteSize.y),
+				                              static_cast<float>(spriteSize.x),
+				                              static_cast<float>(spriteSize.y)
+			                              });
+
+			// Nearest neighbor keeps the pixel art sharp when it can, otherwise we filter once here instead of every frame
+			if (isIntegerScale)
+			{
+				ImageResizeNN(&sprite, scaledSpriteSize.x, scaledSpriteSize.y);
+			}
+			else
+			{
+				ImageResize(&sprite, scaledSpriteSize.x, scaledSpriteSize.y);
+			}
+
+			// Both images are 8-bit RGBA, so the sprite can be copied in row by row
+			const auto* source = static_cast<const unsigned char*>(sprite.data);
+			auto* destination = static_cast<unsigned char*>(scaledAtlas.data);
+			for (int row = 0; row < scaledSpriteSize.y; ++row)
+			{
+				const int destinationPixel = (spriteY * scaledSpriteSize.y + row) * scaledAtlasSize.x
+					+ spriteX * scaledSpriteSize.x;
+
+				std::memcpy(destination + static_cast<size_t>(destinationPixel) * 4,
+				            source + static_cast<size_t>(row) * scaledSpriteSize.x * 4,
+				            static_cast<size_t>(scaledSpriteSize.x) * 4);
+			}
+
+			UnloadImage(sprite);
+		}
+	}
+
+	const Texture2D texture = LoadTextureFromImage(scaledAtlas);
+	SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+	UnloadImage(scaledAtlas);
+
+	return texture;
 }
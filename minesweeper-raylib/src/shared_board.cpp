@@ -0,0 +1,191 @@
+#include "shared_board.h"
+
+#include <new>
+
+#if !defined _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined DEBUG
+#include <iostream>
+#endif
+
+namespace
+{
+	// Where everything goes in a segment for a board with the given amount of cells, the move ring starts at a page
+	struct SegmentLayout
+	{
+		size_t openPlaneOffset;
+		size_t flagPlaneOffset;
+		size_t numberPlaneOffset;
+		size_t moveRingOffset;
+		size_t size;
+	};
+
+	SegmentLayout GetSegmentLayout(const size_t cellsAmount, const size_t pageSize)
+	{
+		SegmentLayout layout{};
+		layout.openPlaneOffset = sizeof(SharedBoardHeader);
+		layout.flagPlaneOffset = layout.openPlaneOffset + cellsAmount;
+		layout.numberPlaneOffset = layout.flagPlaneOffset + cellsAmount;
+		layout.moveRingOffset = (layout.numberPlaneOffset + cellsAmount + pageSize - 1) / pageSize * pageSize;
+		layout.size = layout.moveRingOffset + sizeof(SharedMoveRing);
+
+		return layout;
+	}
+}
+
+
+//	####################
+//	# Public functions #
+//	####################
+
+
+SharedBoard::~SharedBoard()
+{
+#if !defined _WIN32
+	if (segment != nullptr)
+	{
+		munmap(segment, segmentSize);
+		shm_unlink(segmentName.c_str());
+	}
+#endif
+}
+
+bool SharedBoard::Open(const std::string& name, const size_t width, const size_t height)
+{
+#if defined _WIN32
+	(void)name;
+	(void)width;
+	(void)height;
+
+#if defined DEBUG
+	std::cout << "Shared boards need POSIX shared memory, which this system doesn't have\n";
+#endif
+	return false;
+#else
+	// Planes this large couldn't be mapped anyway
+	if (width == 0 || height > SIZE_MAX / 4 / width)
+	{
+		return false;
+	}
+
+	const auto [openPlaneOffset, flagPlaneOffset, numberPlaneOffset, moveRingOffset, size] =
+		GetSegmentLayout(width * height, static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+
+	// A segment left behind by a game that didn't close cleanly is replaced, bots that still have it mapped keep
+	// the old one, which never changes again
+	shm_unlink(name.c_str());
+
+	const int descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if (descriptor < 0)
+	{
+#if defined DEBUG
+		std::cout << "Could not make the shared memory segment " << name << "\n";
+#endif
+		return false;
+	}
+
+	// The segment starts out zeroed, which is a board with every cell closed and unflagged
+	void* mapping = MAP_FAILED;
+	if (ftruncate(descriptor, static_cast<off_t>(size)) == 0)
+	{
+		mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+	}
+	close(descriptor);
+
+	if (mapping == MAP_FAILED)
+	{
+#if defined DEBUG
+		std::cout << "Could not map the shared memory segment " << name << "\n";
+#endif
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	segmentName = name;
+	segment = mapping;
+	segmentSize = size;
+
+	auto* bytes = static_cast<uint8_t*>(segment);
+	header = new(bytes) SharedBoardHeader{};
+	openPlane = bytes + openPlaneOffset;
+	flagPlane = bytes + flagPlaneOffset;
+	numberPlane = bytes + numberPlaneOffset;
+	moveRing = new(bytes + moveRingOffset) SharedMoveRing{};
+
+	header->width = width;
+	header->height = height;
+	header->openPlaneOffset = openPlaneOffset;
+	header->flagPlaneOffset = flagPlaneOffset;
+	header->numberPlaneOffset = numberPlaneOffset;
+	header->moveRingOffset = moveRingOffset;
+	header->version = SharedBoardHeader::VERSION;
+
+	// Bots wait for the magic number, so it's written once everything else is in place
+	std::atomic_thread_fence(std::memory_order_release);
+	header->magic = SharedBoardHeader::MAGIC;
+
+	return true;
+#endif
+}
+
+uint64_t SharedBoard::GetSegmentSize(const size_t& width, const size_t& height)
+{
+#if defined _WIN32
+	(void)width;
+	(void)height;
+
+	return 0;
+#else
+	return GetSegmentLayout(width * height, static_cast<size_t>(sysconf(_SC_PAGESIZE))).size;
+#endif
+}
+
+// The move is copied out of its slot before the slot is handed back to the bot
+bool SharedBoard::TakeMove(BoardMove& move)
+{
+	while (true)
+	{
+		const uint64_t tail = moveRing->tail.load(std::memory_order_relaxed);
+		if (tail == moveRing->head.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		move = moveRing->moves[tail % SharedMoveRing::CAPACITY];
+		moveRing->tail.store(tail + 1, std::memory_order_release);
+
+		// The bot could have written anything, moves of a type the board doesn't know are dropped
+		if (move.type <= BoardMove::CHORD)
+		{
+			return true;
+		}
+	}
+}
+
+void SharedBoard::BeginWrite()
+{
+	header->sequence.store(header->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void SharedBoard::WriteCell(const size_t& cellIndex, const uint8_t& spriteKey)
+{
+	using namespace BoardSprite;
+
+	const bool isOpen = spriteKey >= KEY_OPEN;
+	openPlane[cellIndex] = isOpen;
+	flagPlane[cellIndex] = !isOpen && spriteKey & KEY_FLAGGED;
+	numberPlane[cellIndex] = isOpen ? spriteKey - KEY_OPEN : 0;
+}
+
+void SharedBoard::EndWrite(const SharedBoardHeader::State state, const int64_t minesLeftToFlag)
+{
+	header->state = state;
+	header->minesLeftToFlag = minesLeftToFlag;
+
+	header->sequence.store(header->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
@@ -39,39 +39,32 @@ void Timer::Update()
 
 void Timer::Draw() const
 {
+	const ResourcesSingleton::ScaledAtlases& atlases = ResourcesSingleton::GetInstance().GetScaledAtlases(cellSizePixels);
+
 	const int hundreds = previousTimeElapsed / 100 % 10;
 
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetDigitsAtlasTexture(),
-		Settings::GetDigitSprite(hundreds),
+	RaylibCpp::DrawTextureRec(
+		atlases.digitsAtlasTexture,
+		atlases.GetSprite(Settings::GetDigitSprite(hundreds)),
 		screenPositionPixels,
-		Vec2<int>{cellSizePixels, cellSizePixels * 2},
-		Vec2<int>{0, 0},
-		0,
 		WHITE
 	);
 
 	const int tens = previousTimeElapsed / 10 % 10;
 
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetDigitsAtlasTexture(),
-		Settings::GetDigitSprite(tens),
+	RaylibCpp::DrawTextureRec(
+		atlases.digitsAtlasTexture,
+		atlases.GetSprite(Settings::GetDigitSprite(tens)),
 		Vec2<int>{screenPositionPixels.x + cellSizePixels, screenPositionPixels.y},
-		Vec2<int>{cellSizePixels, cellSizePixels * 2},
-		Vec2<int>{0, 0},
-		0,
 		WHITE
 	);
 
 	const int ones = previousTimeElapsed % 10;
 
-	RaylibCpp::DrawTexturePro(
-		ResourcesSingleton::GetInstance().GetDigitsAtlasTexture(),
-		Settings::GetDigitSprite(ones),
+	RaylibCpp::DrawTextureRec(
+		atlases.digitsAtlasTexture,
+		atlases.GetSprite(Settings::GetDigitSprite(ones)),
 		Vec2<int>{screenPositionPixels.x + cellSizePixels * 2, screenPositionPixels.y},
-		Vec2<int>{cellSizePixels, cellSizePixels * 2},
-		Vec2<int>{0, 0},
-		0,
 		WHITE
 	);
 }
@@ -84,6 +77,19 @@ void Timer::Reset()
 }
 
 
+double Timer::GetTimeElapsed() const
+{
+	return timerStarted ? GetTime() - gameStartTime : 0;
+}
+
+void Timer::SetTimeElapsed(const double& timeElapsed)
+{
+	timerStarted = true;
+	gameStartTime = GetTime() - timeElapsed;
+	previousTimeElapsed = static_cast<int>(timeElapsed) < 999 ? static_cast<int>(timeElapsed) : 999;
+}
+
+
 //	#####################
 //	# Private functions #
 //	#####################
@@ -0,0 +1,22 @@
+
+baseName = path.getbasename(os.getcwd());
+
+-- Plays boards from fixed input scripts with no window, and fails if the board doesn't behave. The board itself is built from the game's own sources
+project (baseName)
+	kind "ConsoleApp"
+	location "../_build"
+	targetdir "../_bin/%{cfg.buildcfg}"
+
+	-- Allocations are only counted in debug builds, so the checks are always built with the counting hooks
+	defines { "DEBUG" }
+
+	vpaths
+	{
+	  ["Header Files/*"] = { "../minesweeper-raylib/include/**.h"},
+	  ["Source Files/*"] = { "src/**.cpp", "../minesweeper-raylib/src/**.cpp"},
+	}
+	files {"src/**.cpp", "../minesweeper-raylib/src/**.cpp", "../minesweeper-raylib/include/**.h"}
+	removefiles {"../minesweeper-raylib/src/main.cpp"}
+
+	includedirs { "./", "src", "../minesweeper-raylib/include"}
+	link_raylib();
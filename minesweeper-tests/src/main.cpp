@@ -0,0 +1,333 @@
+#include "allocation_tracker.h"
+#include "board.h"
+#include "game.h"
+#include "input_queue.h"
+#include "raylib_cpp.h"
+#include "settings.h"
+#include "shared_board.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#if !defined _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	constexpr int CELL_SIZE_PIXELS = 16;
+	constexpr uint32_t LAYOUT_SEED = 2024;
+	constexpr uint32_t SCRIPT_SEED = 7;
+	constexpr int GAME_FPS = 60;
+	constexpr const char* SHARED_BOARD_NAME = "/minesweeper-tests";
+
+	// One frame of input, the way the game hands it to the board
+	struct ScriptStep
+	{
+		enum Type : uint8_t
+		{
+			CLICK,
+			UNDO,
+			REDO,
+			HINT,
+			RESTART
+		};
+
+		Type type = CLICK;
+		std::array<MouseState, 2> mouseStates = {}; // A button going down and coming back up, on the same cell
+	};
+
+	// The script comes from a fixed seed, and only uses the generator's raw output, which is the same everywhere.
+	// Most steps are clicks, the rest are the keyboard shortcuts and the face button
+	std::vector<ScriptStep> CreateInputScript(const Vec2<int>& boardSizeCells, const size_t& stepsAmount)
+	{
+		std::mt19937 generator{SCRIPT_SEED};
+		std::vector<ScriptStep> script(stepsAmount);
+
+		for (ScriptStep& step : script)
+		{
+			const uint32_t roll = generator() % 100;
+			if (roll >= 90)
+			{
+				step.type = roll < 94 ? ScriptStep::UNDO : roll < 97 ? ScriptStep::REDO : roll < 99 ? ScriptStep::HINT : ScriptStep::RESTART;
+				continue;
+			}
+
+			const Vec2<int> cellPos{
+				static_cast<int>(generator() % static_cast<uint32_t>(boardSizeCells.x)),
+				static_cast<int>(generator() % static_cast<uint32_t>(boardSizeCells.y))
+			};
+			const Vec2<int> mousePos = cellPos * CELL_SIZE_PIXELS + CELL_SIZE_PIXELS / 2;
+
+			// Opening, flagging and chording, in the same proportions a player might use them
+			std::array<bool, 3> buttons = {};
+			if (roll < 60)
+			{
+				buttons[RaylibCpp::MOUSE_LEFT_CLICK] = true;
+			}
+			else if (roll < 80)
+			{
+				buttons[RaylibCpp::MOUSE_RIGHT_CLICK] = true;
+			}
+			else
+			{
+				buttons[RaylibCpp::MOUSE_MIDDLE_CLICK] = true;
+			}
+
+			step.mouseStates[0] = MouseState{buttons, {}, mousePos};
+			step.mouseStates[1] = MouseState{{}, buttons, mousePos};
+		}
+
+		return script;
+	}
+
+	// Plays a step like a frame of the game would, and restarts the game if it ends
+	void PlayScriptStep(Board& board, const ScriptStep& step, const Vec2<int>& screenSizePixels)
+	{
+		switch (step.type)
+		{
+		case ScriptStep::CLICK:
+			board.ProcessMouseStates(step.mouseStates, screenSizePixels);
+			break;
+		case ScriptStep::UNDO:
+			board.Undo();
+			break;
+		case ScriptStep::REDO:
+			board.Redo();
+			break;
+		case ScriptStep::HINT:
+			board.ShowHint();
+			break;
+		case ScriptStep::RESTART:
+			board.Reset();
+			break;
+		}
+
+		if (board.GetOutcome() != BoardSprite::IN_PROGRESS)
+		{
+			board.Reset();
+		}
+
+		board.EndTick();
+	}
+
+	void PlayInputScript(Board& board, const std::span<const ScriptStep> script, const Vec2<int>& screenSizePixels)
+	{
+		for (const ScriptStep& step : script)
+		{
+			PlayScriptStep(board, step, screenSizePixels);
+		}
+	}
+
+	// Once a board has played a game of its size, playing more of them shouldn't allocate anything. The script is
+	// played once to get there, and then again, which has to leave the allocation count where it was
+	bool CheckBoardPlaysWithoutAllocating(const Vec2<int>& boardSizeCells, const uint64_t& minesAmount, const size_t& stepsAmount)
+	{
+		const Vec2<int> screenSizePixels = boardSizeCells * CELL_SIZE_PIXELS;
+		const std::vector<ScriptStep> script = CreateInputScript(boardSizeCells, stepsAmount);
+
+		Board board{
+			Vec2<int>{0},
+			CELL_SIZE_PIXELS,
+			static_cast<size_t>(boardSizeCells.x),
+			static_cast<size_t>(boardSizeCells.y),
+			minesAmount,
+			false
+		};
+		board.SetSeed(LAYOUT_SEED);
+
+		PlayInputScript(board, script, screenSizePixels);
+
+		const size_t allocationsBefore = AllocationTracker::GetAllocationCount();
+		PlayInputScript(board, script, screenSizePixels);
+		const size_t allocations = AllocationTracker::GetAllocationCount() - allocationsBefore;
+
+		std::cout << boardSizeCells.x << "x" << boardSizeCells.y << " board with " << minesAmount << " mines: "
+			<< allocations << " allocations\n";
+
+		return allocations == 0;
+	}
+
+	// The hint solver only checks the numbers whose surroundings changed since the last hint. Loading a snapshot of
+	// the board rebuilds the frontier, which leaves every number to be checked, so after every step the played board
+	// has to find the same hint as a copy of it that was loaded from a snapshot
+	bool CheckHintsMatchRebuiltSolver(const Vec2<int>& boardSizeCells, const uint64_t& minesAmount, const size_t& stepsAmount)
+	{
+		const Vec2<int> screenSizePixels = boardSizeCells * CELL_SIZE_PIXELS;
+		const std::vector<ScriptStep> script = CreateInputScript(boardSizeCells, stepsAmount);
+		const std::string snapshotPath = (std::filesystem::temp_directory_path() / "minesweeper-tests-hint.bin").string();
+		const auto widthCells = static_cast<size_t>(boardSizeCells.x);
+		const auto heightCells = static_cast<size_t>(boardSizeCells.y);
+
+		Board board{Vec2<int>{0}, CELL_SIZE_PIXELS, widthCells, heightCells, minesAmount, false};
+		Board rebuiltBoard{Vec2<int>{0}, CELL_SIZE_PIXELS, widthCells, heightCells, minesAmount, false};
+		board.SetSeed(LAYOUT_SEED);
+
+		BoardView view{};
+		BoardView rebuiltView{};
+		size_t hintsChecked = 0;
+		size_t mismatches = 0;
+
+		for (const ScriptStep& step : script)
+		{
+			PlayScriptStep(board, step, screenSizePixels);
+
+			double timeElapsed = 0;
+			if (!board.SaveSnapshot(snapshotPath, timeElapsed) || !rebuiltBoard.LoadSnapshot(snapshotPath, timeElapsed))
+			{
+				continue;
+			}
+
+			const bool isHintShown = board.ShowHint();
+			const bool isRebuiltHintShown = rebuiltBoard.ShowHint();
+			board.EndTick();
+			rebuiltBoard.EndTick();
+
+			board.CopyView(view, screenSizePixels);
+			rebuiltBoard.CopyView(rebuiltView, screenSizePixels);
+
+			// A safe cell stays outlined until it's opened or flagged, so the played board can still show an older one
+			const bool isRebuiltHintSafe = rebuiltView.hintedCell != BoardView::NO_CELL;
+			bool isMatching = isHintShown == isRebuiltHintShown && (!isRebuiltHintSafe || view.hintedCell == rebuiltView.hintedCell);
+			for (size_t cellIndex = 0; cellIndex < widthCells * heightCells; ++cellIndex)
+			{
+				isMatching = isMatching && board.GetCellSpriteKey(cellIndex) == rebuiltBoard.GetCellSpriteKey(cellIndex);
+			}
+
+			hintsChecked += isHintShown || isRebuiltHintShown;
+			mismatches += !isMatching;
+		}
+
+		std::filesystem::remove(snapshotPath);
+
+		std::cout << boardSizeCells.x << "x" << boardSizeCells.y << " board with " << minesAmount << " mines: "
+			<< hintsChecked << " hints, " << mismatches << " different from a rebuilt solver\n";
+
+		return mismatches == 0;
+	}
+
+#if !defined _WIN32
+	// The moves go through a shared board, like a bot's would, so the whole game plays them in its own frames.
+	// Two rows of flags fence off the first row and the last one. The first click opens the first row, which starts
+	// the game, then a flag is taken away and the next click opens everything between the fences in a single frame.
+	// The game is still in progress after that, so none of the frames it takes to show it may allocate anything
+	bool CheckCascadeTicksWithoutAllocating(const Vec2<int>& boardSizeCells)
+	{
+		const auto widthCells = static_cast<size_t>(boardSizeCells.x);
+		const auto heightCells = static_cast<size_t>(boardSizeCells.y);
+
+		SetConfigFlags(FLAG_WINDOW_HIDDEN);
+		Game game{
+			GAME_FPS,
+			"minesweeper-tests",
+			Settings::MIN_RESIZED_CELL_SIZE_PIXELS,
+			widthCells,
+			heightCells,
+			0,
+			false,
+			false,
+			Settings::ENDLESS_DEFAULT_MINE_DENSITY,
+			false,
+			false,
+			false,
+			SHARED_BOARD_NAME,
+			1
+		};
+
+		const int descriptor = shm_open(SHARED_BOARD_NAME, O_RDWR, 0);
+		if (descriptor < 0)
+		{
+			std::cout << "Could not open the shared board " << SHARED_BOARD_NAME << "\n";
+			return false;
+		}
+
+		const size_t segmentSize = SharedBoard::GetSegmentSize(widthCells, heightCells);
+		void* segment = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+		close(descriptor);
+		if (segment == MAP_FAILED)
+		{
+			std::cout << "Could not map the shared board " << SHARED_BOARD_NAME << "\n";
+			return false;
+		}
+
+		auto* bytes = static_cast<uint8_t*>(segment);
+		const auto* header = reinterpret_cast<const SharedBoardHeader*>(bytes);
+		const std::span<const uint8_t> openPlane{bytes + header->openPlaneOffset, widthCells * heightCells};
+		auto* moveRing = reinterpret_cast<SharedMoveRing*>(bytes + header->moveRingOffset);
+
+		const auto pushMove = [moveRing](const BoardMove::Type type, const size_t x, const size_t y)
+		{
+			const uint64_t head = moveRing->head.load(std::memory_order_relaxed);
+			moveRing->moves[head % SharedMoveRing::CAPACITY] = BoardMove{type, x, y};
+			moveRing->head.store(head + 1, std::memory_order_release);
+		};
+		const auto playFrames = [&game](const int framesAmount)
+		{
+			for (int i = 0; i < framesAmount; ++i)
+			{
+				game.Tick();
+			}
+		};
+
+		// The first frames set up the window and whatever it draws with, which is allowed to allocate
+		playFrames(3);
+
+		for (size_t x = 0; x < widthCells; ++x)
+		{
+			pushMove(BoardMove::FLAG, x, 1);
+			pushMove(BoardMove::FLAG, x, heightCells - 2);
+		}
+		pushMove(BoardMove::OPEN, 0, 0);
+		playFrames(3);
+
+		const size_t allocationsBefore = AllocationTracker::GetAllocationCount();
+		pushMove(BoardMove::FLAG, 0, 1);
+		pushMove(BoardMove::OPEN, 0, 2);
+		playFrames(3);
+		const size_t allocations = AllocationTracker::GetAllocationCount() - allocationsBefore;
+
+		const auto cellsOpened = static_cast<size_t>(std::ranges::count(openPlane, uint8_t{1}));
+		const size_t expectedCellsOpened = widthCells * (heightCells - 3) + 1;
+		const bool isGameInProgress = header->state == SharedBoardHeader::PLAYING;
+
+		munmap(segment, segmentSize);
+
+		std::cout << boardSizeCells.x << "x" << boardSizeCells.y << " board opened " << cellsOpened << " of "
+			<< expectedCellsOpened << " cells through the game's frames: " << allocations << " allocations\n";
+
+		return allocations == 0 && cellsOpened == expectedCellsOpened && isGameInProgress;
+	}
+#endif
+}
+
+// Returns 1 if any check fails, so it can be run after every build
+int main()
+{
+	bool isPassing = true;
+	isPassing &= CheckBoardPlaysWithoutAllocating(Vec2<int>{9}, 10, 20000);
+	isPassing &= CheckBoardPlaysWithoutAllocating(Vec2<int>{30, 16}, 99, 20000);
+
+	// More cells than the session buffers are reserved for, so they're capped instead of sized for the whole board
+	isPassing &= CheckBoardPlaysWithoutAllocating(Vec2<int>{300, 300}, 9000, 2000);
+
+#if !defined _WIN32
+	// A single reveal of more cells than the session buffers are reserved for, in a frame of the whole game
+	isPassing &= CheckCascadeTicksWithoutAllocating(Vec2<int>{128, 1024});
+#endif
+
+	isPassing &= CheckHintsMatchRebuiltSolver(Vec2<int>{9}, 10, 20000);
+	isPassing &= CheckHintsMatchRebuiltSolver(Vec2<int>{16}, 40, 20000);
+	isPassing &= CheckHintsMatchRebuiltSolver(Vec2<int>{30, 16}, 99, 20000);
+
+	std::cout << (isPassing ? "All checks passed\n" : "Some checks failed\n");
+	return isPassing ? 0 : 1;
+}
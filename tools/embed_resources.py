@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Converts the PNG atlases in resources/ into raw RGBA byte arrays in minesweeper-raylib/include/embedded_resources.h.
+
+Run this from the repository root after changing any of the images:
+    python3 tools/embed_resources.py
+
+With --check, nothing is written, and the script fails if the header doesn't match the images.
+The game's build runs it that way before compiling, so an image that was changed without
+regenerating the header fails the build instead of shipping the old pixels.
+
+Only the Python standard library is used, so the images are decoded by hand.
+The decoder only supports what the resources use: 8-bit RGBA, non-interlaced PNGs.
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+RESOURCES = [
+    ("CELL_ATLAS", "resources/cell_atlas.png"),
+    ("DIGITS_ATLAS", "resources/digits_atlas.png"),
+    ("FACE_ATLAS", "resources/face_atlas.png"),
+    ("ICON", "resources/icon.png"),
+]
+
+OUTPUT_PATH = "minesweeper-raylib/include/embedded_resources.h"
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    if pb <= pc:
+        return b
+    return c
+
+
+def decode_png(path):
+    with open(path, "rb") as file:
+        data = file.read()
+
+    assert data[:8] == b"\x89PNG\r\n\x1a\n", f"{path} is not a PNG file"
+
+    offset = 8
+    width = height = 0
+    compressed = b""
+    while offset < len(data):
+        length, chunk_type = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += length + 12
+
+        if chunk_type == b"IHDR":
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+            assert bit_depth == 8 and color_type == 6 and interlace == 0, f"{path} must be a non-interlaced 8-bit RGBA PNG"
+        elif chunk_type == b"IDAT":
+            compressed += chunk
+        elif chunk_type == b"IEND":
+            break
+
+    raw = zlib.decompress(compressed)
+    stride = width * 4
+    pixels = bytearray(stride * height)
+    previous = bytearray(stride)
+
+    for y in range(height):
+        filter_type = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+
+        for x in range(stride):
+            left = row[x - 4] if x >= 4 else 0
+            up = previous[x]
+            up_left = previous[x - 4] if x >= 4 else 0
+
+            if filter_type == 1:
+                row[x] = (row[x] + left) & 0xFF
+            elif filter_type == 2:
+                row[x] = (row[x] + up) & 0xFF
+            elif filter_type == 3:
+                row[x] = (row[x] + (left + up) // 2) & 0xFF
+            elif filter_type == 4:
+                row[x] = (row[x] + paeth(left, up, up_left)) & 0xFF
+
+        pixels[y * stride:(y + 1) * stride] = row
+        previous = row
+
+    return width, height, pixels
+
+
+def generate_header():
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by tools/embed_resources.py from the images in resources/, do not edit by hand.",
+        "// The pixels are already decoded to 8-bit RGBA, so they can be uploaded to the GPU without any file I/O.",
+        "",
+        "namespace EmbeddedResources",
+        "{",
+    ]
+
+    for name, path in RESOURCES:
+        width, height, pixels = decode_png(path)
+
+        lines.append(f"\tconstexpr int {name}_WIDTH = {width};")
+        lines.append(f"\tconstexpr int {name}_HEIGHT = {height};")
+        lines.append(f"\tinline constexpr unsigned char {name}_PIXELS[] = {{")
+        for start in range(0, len(pixels), 32):
+            lines.append("\t\t" + ",".join(str(byte) for byte in pixels[start:start + 32]) + ",")
+        lines.append("\t};")
+        lines.append("")
+
+    lines[-1] = "}"
+
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    header = generate_header()
+
+    if "--check" in sys.argv[1:]:
+        with open(OUTPUT_PATH, "r") as file:
+            if file.read() != header:
+                print(f"{OUTPUT_PATH} doesn't match the images in resources/, run python3 tools/embed_resources.py", file=sys.stderr)
+                return 1
+        return 0
+
+    with open(OUTPUT_PATH, "w", newline="\n") as file:
+        file.write(header)
+    return 0
+
+
+if __name__ == "__main__":
+    os.chdir(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    sys.exit(main())